@@ -0,0 +1,30 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+//  Compiler specific macros
+//  Disables clang modernize suggestions
+#ifdef __GNUC__
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "modernize-use-nodiscard"
+#endif
+
+#include <cstddef>
+
+/** \class AllocationCounter
+ *  \brief Counts the heap allocations of each thread, for benchmarks that check what code allocates.
+ *  \remarks Replaces the global <code>operator new</code> and <code>operator delete</code> (over-aligned ones
+ *           excepted) with ones that count allocations, then forward to <code>malloc</code> and <code>free</code>.
+ *           Counting costs an increment of a thread local counter per allocation, so the counter is only built in
+ *           when <code>COUNT_ALLOCATIONS</code> is defined (CMake option of the same name, off by default). */
+class AllocationCounter
+{
+public:
+    /** \brief Returns the number of allocations made through <code>operator new</code> by the calling thread so far. */
+    static size_t allocations();
+};
+
+#ifdef __GNUC__
+#pragma clang diagnostic pop
+#endif
+
+#endif // ALLOCATION_COUNTER_H
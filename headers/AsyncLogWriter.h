@@ -0,0 +1,94 @@
+#ifndef ASYNC_LOG_WRITER_H
+#define ASYNC_LOG_WRITER_H
+
+//  Compiler specific macros
+//  Disables clang modernize suggestions
+#ifdef __GNUC__
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "modernize-use-nodiscard"
+#endif
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <thread>
+
+/** \class AsyncLogWriter
+ *  \brief Appends lines to a log file from a background thread.
+ *  \remarks <code>write(...)</code> only moves the line into a bounded lock-free queue. The writer thread drains the
+ *           queue in batches every few milliseconds, or as soon as the queue is half full, writing each batch with a
+ *           single append. A full queue makes producers wait for room instead of dropping lines.
+ *           <code>flush()</code> waits until every line written so far is in the file, and the destructor flushes
+ *           before joining the writer thread. Not copyable or movable. */
+class AsyncLogWriter
+{
+public:
+    /** \brief Truncates the file at the given path and starts the writer thread.
+     *  \param filePath     The log file.
+     *  \param capacity     The number of lines the queue holds, rounded up to a power of two. */
+    explicit AsyncLogWriter(const std::string &filePath, size_t capacity = 8192);
+
+    /** \brief Flushes, then stops the writer thread. */
+    ~AsyncLogWriter();
+
+    //  Deleted members
+    AsyncLogWriter(const AsyncLogWriter &) = delete;
+    AsyncLogWriter &operator=(const AsyncLogWriter &) = delete;
+
+    /** \brief Queues a line to be appended to the log. A newline is added to it. Safe to call from any thread. */
+    void write(std::string line);
+
+    /** \brief Blocks until every line queued before the call has been written to the file. */
+    void flush();
+
+    /** \brief Returns whether the log file could be opened. Lines written to a writer that is not open are dropped. */
+    bool isOpen() const;
+
+private:
+    //  A queue cell. The sequence number tells producers and the consumer whose turn it is to use the cell
+    //  (bounded MPMC queue of D. Vyukov, with a single consumer)
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        std::string line;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+
+    //  Next position claimed by a producer
+    alignas(64) std::atomic<size_t> enqueuePosition{0};
+
+    //  Next position read by the writer thread, and the number of lines it has written to the file
+    alignas(64) size_t dequeuePosition = 0;
+    std::atomic<size_t> linesWritten{0};
+
+    //  Wakes the writer thread before its next periodic drain. Producers only take the lock on the rare occasions
+    //  they wake it
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    bool wakeRequested = false;
+    bool stopping = false;
+
+    std::ofstream file;
+    std::thread writerThread;
+
+    //  Body of the writer thread
+    void run();
+
+    //  Moves the next line of the queue into 'line'. Returns false if the queue is empty
+    bool pop(std::string &line);
+
+    //  Wakes the writer thread if it is waiting for lines
+    void wakeWriter();
+};
+
+#ifdef __GNUC__
+#pragma clang diagnostic pop
+#endif
+
+#endif // ASYNC_LOG_WRITER_H
@@ -0,0 +1,96 @@
+#ifndef BINARY_LOG_OBSERVER_H
+#define BINARY_LOG_OBSERVER_H
+
+//  Compiler specific macros
+//  Disables clang modernize suggestions
+#ifdef __GNUC__
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "modernize-use-nodiscard"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "LoggingObserver.h"
+#include "EventLogFormat.h"
+
+/**
+ * \class   BinaryLogObserver
+ * \brief   Observer writing every event it is notified of as a fixed-size record (see <code>EventLogFormat.h</code>)
+ *          into a memory-mapped file, to be rendered as text later by the log decoder.
+ * \remarks Events are described through <code>ILoggable::toLogEntry()</code>, so no string is built for them. Only
+ *          events without a structured description fall back to <code>stringToLog()</code>. Players and territories
+ *          are named once per game. The file grows as needed, and is trimmed to its contents when the observer is
+ *          destroyed. Not thread-safe: attach one observer per game.
+ */
+class BinaryLogObserver : public Observer
+{
+public:
+    /**
+     * \brief   Creates (or truncates) the log file at the given path
+     */
+    explicit BinaryLogObserver(const std::string &filePath = "gamelog.bin");
+
+    /**
+     * \brief   Writes the number of records to the header, trims the file and closes it
+     */
+    ~BinaryLogObserver() override;
+
+    //  Deleted members
+    BinaryLogObserver(const BinaryLogObserver &) = delete;
+    BinaryLogObserver &operator=(const BinaryLogObserver &) = delete;
+
+    /**
+     * \brief   Appends the record of the event to the log
+     */
+    void Update(ILoggable *log) override;
+
+    /**
+     * \brief   Writes the number of records to the header, so that the log can be decoded while still open
+     */
+    void Flush() override;
+
+    /**
+     * \brief   Returns whether the log file could be created. Events are dropped otherwise
+     */
+    bool isOpen() const { return blocks != nullptr; }
+
+private:
+    std::string filePath;
+
+    //  The mapped file: the header, followed by 'capacity' blocks of which 'used' hold records
+    int fileDescriptor = -1;
+    EventLogHeader *header = nullptr;
+    EventRecord *blocks = nullptr;
+    size_t capacity = 0;
+    size_t used = 0;
+
+    //  Turn of the game loop, from the last 'TurnStarted' event
+    std::uint32_t turn = 0;
+
+    //  Ids given to the players and territories named so far in the current game
+    std::unordered_map<const void *, std::uint32_t> playerIds;
+    std::unordered_map<const void *, std::uint32_t> territoryIds;
+
+    //  Returns the id of a player/territory, naming it first if it is new to the game
+    std::uint32_t idOf(const Player *player);
+    std::uint32_t idOf(const Territory *territory);
+
+    //  Appends a record, followed by the blocks of its text if any
+    void append(const EventRecord &record, std::string_view text = {});
+
+    //  Maps a bigger file. Returns false if it cannot be grown
+    bool grow(size_t minimumCapacity);
+
+    //  Releases the mapping and the file
+    void close();
+};
+
+#ifdef __GNUC__
+#pragma clang diagnostic pop
+#endif
+
+#endif // BINARY_LOG_OBSERVER_H
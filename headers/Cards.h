@@ -12,6 +12,7 @@
 class Player;           //  Player.h
 class Deck;             //  Map.h
 class Territory;        //  Map.h
+class Random;           //  Random.h
 
 
 
@@ -88,21 +89,33 @@ private:
     type cardType;
 };
 
+/**
+ * \class   Deck
+ * \brief   The deck of a game. Owns the cards it currently holds, cards drawn from it are owned by the drawing player's
+ *          hand until they are played or returned.
+ * \remarks Each game engine owns its own deck, so games running concurrently never share cards and need no locking.
+ */
 class Deck
 {
 public:
-    static Deck &getInstance();
-
     /**
-     * \brief   Empty constructor
+     * \brief   Creates a deck of 15 cards, 3 of each type.
      */
     Deck();
 
     /**
-     * \brief
-     * \return
+     * \brief               Draws a random card, removing it from the deck.
+     * \param random        The random number generator of the game.
+     * \return              The drawn card, or nullptr if the deck is empty.
+     */
+    Card *draw(Random &random);
+
+    /**
+     * \brief               Takes a card of the given type out of the deck, e.g. to restore a saved hand.
+     * \param cardType      The type of the card.
+     * \return              The card, or nullptr if the deck holds no card of the type.
      */
-    Card *draw();
+    Card *take(type cardType);
 
     /**
      * \brief               Add a Card to the deck.
@@ -117,7 +130,7 @@ public:
     int getDeckSize() const;
 
     /**
-     * \brief   Deconstructs the Deck object.
+     * \brief   Deconstructs the Deck object, deleting the cards it holds.
      */
     ~Deck();
 
@@ -0,0 +1,65 @@
+#ifndef COMBAT_H
+#define COMBAT_H
+
+//  Compiler specific macros
+//  Disables clang modernize suggestions
+#ifdef __GNUC__
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "modernize-use-nodiscard"
+#endif
+
+//  Forward declaration of required classes from other header files. (included in .cpp file)
+class Random; //  Random.h
+
+/** \brief Probability of an attacking unit killing a defending unit in a battle. */
+constexpr double ATTACKER_KILL_PROBABILITY = 0.6;
+
+/** \brief Probability of a defending unit killing an attacking unit in a battle. */
+constexpr double DEFENDER_KILL_PROBABILITY = 0.7;
+
+/** \brief Returns how many enemy units are killed by the given number of units, each of them killing one with the given
+ *         probability independently of the others.
+ *  \remarks The result follows the same binomial distribution as rolling once per unit, but large armies draw it
+ *           directly: with inversion when few kills (or few misses) are expected, otherwise with the rejection sampler
+ *           of <code>std::binomial_distribution</code>. Both are exact, and the cost no longer grows with the size of
+ *           the army. Armies of up to a hundred units or so are still rolled unit by unit, which is cheaper for them.
+ *  \param units        The number of units fighting. Nothing is killed by 0 or less.
+ *  \param probability  The probability of a unit killing an enemy unit, in [0, 1].
+ *  \param random       The random number generator of the game.
+ */
+int sampleKills(int units, double probability, Random &random);
+
+/** \brief Reference implementation of <code>sampleKills(...)</code>, rolling once per unit. Used to check and time the
+ *         sampler against.
+ */
+int sampleKillsPerUnit(int units, double probability, Random &random);
+
+/** \class CombatOdds
+ *  \brief The odds of an attack, as an advance order plays it out: the probability of conquering the target, and the
+ *         number of units expected to occupy it once conquered.
+ *  \remarks Both come from tables filled by dynamic programming over the kills of both sides, for battles of up to
+ *           <code>MAX_TABLE_UNITS</code> units a side. The tables start small and double as larger battles are looked
+ *           up, so lookups are O(1) once the tables have grown. Larger battles, where the kills are close to normally
+ *           distributed, use a normal approximation. Each thread fills tables of its own: lookups take no lock. */
+class CombatOdds
+{
+public:
+    /** \brief Largest number of units a side the tables hold. */
+    static constexpr int MAX_TABLE_UNITS = 256;
+
+    /** \brief Returns the probability that the given number of attacking units conquers a territory held by the given
+     *         number of defending units.
+     */
+    static double conquestProbability(int attackers, int defenders);
+
+    /** \brief Returns the number of attacking units expected to survive the battle, and so to occupy the territory if
+     *         they conquer it. Whether they conquer it does not change their losses.
+     */
+    static double expectedSurvivors(int attackers, int defenders);
+};
+
+#ifdef __GNUC__
+#pragma clang diagnostic pop
+#endif
+
+#endif // COMBAT_H
@@ -0,0 +1,67 @@
+#ifndef DYNAMIC_BITSET_H
+#define DYNAMIC_BITSET_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <bit>
+#include <algorithm>
+
+/** \class DynamicBitset
+ *  \brief A resizable, densely packed set of bits indexed by integer ids (territory ids, player ids, ...).
+ *  \remarks Unlike <code>std::vector<bool></code>, exposes word-level operations (<code>count()</code>,
+ *           <code>reset()</code>) that run over 64 bits at a time. */
+class DynamicBitset
+{
+public:
+    /** \brief Constructs an empty bitset. */
+    DynamicBitset() = default;
+
+    /** \brief Constructs a bitset of the given size with every bit cleared. */
+    explicit DynamicBitset(size_t size) : numBits(size), words(wordsFor(size), 0) {}
+
+    /** \brief Returns the number of addressable bits. */
+    size_t size() const noexcept { return numBits; }
+
+    /** \brief Grows or shrinks the bitset. New bits are cleared. */
+    void resize(size_t size)
+    {
+        words.resize(wordsFor(size), 0);
+        // Clear the bits past the new end so that a later grow starts from zero
+        if (size % 64 != 0 && !words.empty())
+            words.back() &= (uint64_t{1} << (size % 64)) - 1;
+        numBits = size;
+    }
+
+    /** \brief Returns whether the given bit is set. Out of range bits read as cleared. */
+    bool test(size_t index) const noexcept
+    {
+        return index < numBits && (words[index / 64] >> (index % 64)) & 1;
+    }
+
+    /** \brief Sets the given bit. */
+    void set(size_t index) noexcept { words[index / 64] |= uint64_t{1} << (index % 64); }
+
+    /** \brief Clears the given bit. */
+    void reset(size_t index) noexcept { words[index / 64] &= ~(uint64_t{1} << (index % 64)); }
+
+    /** \brief Clears every bit, keeping the size. */
+    void reset() noexcept { std::fill(words.begin(), words.end(), 0); }
+
+    /** \brief Returns the number of set bits. */
+    size_t count() const noexcept
+    {
+        size_t total = 0;
+        for (uint64_t word : words)
+            total += std::popcount(word);
+        return total;
+    }
+
+private:
+    static size_t wordsFor(size_t size) noexcept { return (size + 63) / 64; }
+
+    size_t numBits = 0;
+    std::vector<uint64_t> words;
+};
+
+#endif // DYNAMIC_BITSET_H
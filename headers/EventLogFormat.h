@@ -0,0 +1,73 @@
+#ifndef EVENT_LOG_FORMAT_H
+#define EVENT_LOG_FORMAT_H
+
+#include <cstdint>
+
+/*
+ *  Layout of a binary event log file (see BinaryLogObserver), shared with the log decoder:
+ *
+ *      EventLogHeader
+ *      EventRecord[numRecords]
+ *
+ *  Every block after the header is 32 bytes. Most events fit in a single record. Records carrying text (names,
+ *  state names, free-form text) are followed by ceil(textLength / 32) blocks of raw characters.
+ *
+ *  Players and territories are referred to by ids. The first time one appears in a game, a PlayerName or
+ *  TerritoryName record binding its id to its name is written before the event.
+ *  All values are stored in the byte order of the machine that wrote the log.
+ */
+
+/** \brief Kind of a logged event, or of a record of the binary event log. */
+enum class LogEventKind : std::uint8_t
+{
+    None = 0,           //  Unused record, e.g. the end of a log that was not closed properly
+    Text,               //  Free-form text, the string to log of events without a structured form
+    OrderIssued,        //  An order was added to the orders list of a player
+    OrderExecuted,      //  An order was executed
+    StateChanged,       //  The game engine transitioned into a new state
+    TurnStarted,        //  A turn of the game loop started
+    PlayerName,         //  Binds a player id to a name
+    TerritoryName,      //  Binds a territory id to a name
+};
+
+/** \brief Identifies a binary event log: "RISKLOG" followed by a null byte. */
+constexpr char EVENT_LOG_MAGIC[8] = {'R', 'I', 'S', 'K', 'L', 'O', 'G', '\0'};
+
+/** \brief Version of the binary event log format. */
+constexpr std::uint32_t EVENT_LOG_VERSION = 1;
+
+/** \brief Written as-is: reads back differently on a machine of the other byte order. */
+constexpr std::uint32_t EVENT_LOG_BYTE_ORDER = 0x01020304;
+
+/** \brief Id of a player or territory that an event does not refer to. */
+constexpr std::uint32_t EVENT_LOG_NO_ID = 0xFFFFFFFF;
+
+/** \brief Header of a binary event log. */
+struct EventLogHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint64_t numRecords;   //  Number of 32 byte blocks following the header. 0 if the log was not closed properly
+    std::uint64_t reserved;
+};
+
+/** \brief A fixed-size event record. */
+struct EventRecord
+{
+    LogEventKind kind;
+    std::uint8_t orderType;     //  Order::OrderType of order events
+    std::uint16_t textLength;   //  Number of characters in the blocks following the record
+    std::uint32_t turn;         //  Turn of the game loop the event happened in, 0 before the game loop
+    std::uint32_t player;       //  Player the event is about
+    std::uint32_t otherPlayer;  //  Second player of the event, e.g. the one negotiated with
+    std::uint32_t target;       //  Territory targeted by an order
+    std::uint32_t source;       //  Territory armies are moved from
+    std::int32_t armies;        //  Army units deployed or moved
+    std::int32_t value;         //  Kind specific: armies left on the target, turn started, id being named
+};
+
+static_assert(sizeof(EventLogHeader) == 32, "The event log header must be 32 bytes");
+static_assert(sizeof(EventRecord) == 32, "Event records must be 32 bytes");
+
+#endif // EVENT_LOG_FORMAT_H
@@ -4,9 +4,42 @@
 #pragma once
 
 #include <list>
+#include <memory>
 #include <string>
+
+#include "EventLogFormat.h"
 using namespace std;
 
+//  Forward declaration of required classes from other header files. (included in .cpp file)
+class AsyncLogWriter; //  AsyncLogWriter.h
+class Player;         //  player/Player.h
+class Territory;      //  Map.h
+
+/**
+ * \struct  LogEntry
+ * \brief   Structured description of a logged event: what happened, to whom and where, without formatting it into a
+ *          string. Written as is by the binary event log.
+ */
+struct LogEntry
+{
+    // what happened. Text entries are logged through 'stringToLog()' instead
+    LogEventKind kind = LogEventKind::Text;
+    // Order::OrderType of order events
+    int orderType = 0;
+    // player the event is about, and second player of the event
+    const Player *player = nullptr;
+    const Player *otherPlayer = nullptr;
+    // territory targeted by an order, and territory armies are moved from
+    const Territory *target = nullptr;
+    const Territory *source = nullptr;
+    // army units deployed or moved
+    int armies = 0;
+    // kind specific: armies left on the target, turn started
+    int value = 0;
+    // kind specific text: name of the new state
+    string text;
+};
+
 /**
  * \class   ILoggable
  * \brief   Abstract class to be inherited by classes to log info
@@ -25,6 +58,12 @@ public:
      */
     virtual string stringToLog() = 0;
 
+    /**
+     * \brief   Describes the event without formatting it, for logs that format it later (if ever)
+     * \return  The description. By default a Text entry, telling the observer to log 'stringToLog()' instead
+     */
+    virtual LogEntry toLogEntry();
+
     /**
      * \brief   Assigns new values to member variables of the ILoggable object
      * \param   ILoggable ILoggable object from which new values are to be taken
@@ -54,6 +93,11 @@ public:
     virtual ~Observer();
     virtual void Update(ILoggable *log) = 0;
 
+    /**
+     * \brief   Makes sure every update received so far has been fully processed. Does nothing by default
+     */
+    virtual void Flush();
+
     /**
      * \brief   Assigns new values to member variables of the Observer object
      * \param   Observer Observer object from which new values are to be taken
@@ -78,7 +122,7 @@ class Subject
 {
 public:
     /**
-     * \brief   Attach to the param observer
+     * \brief   Attach to the param observer. Attaching an observer that is already attached does nothing
      * \param   Observer observer object
      */
     virtual void Attach(Observer *o);
@@ -95,6 +139,16 @@ public:
      */
     virtual void notify(ILoggable *log);
 
+    /**
+     * \brief   Flushes every attached observer, e.g. at the end of a game
+     */
+    void flushObservers();
+
+    /**
+     * \brief   Attaches every observer of this subject to another subject, e.g. to the objects it creates
+     */
+    void attachObserversTo(Subject &other) const;
+
     /**
      * \brief   Default constructor
      */
@@ -106,7 +160,7 @@ public:
     ~Subject();
 
     /**
-     * \brief   Copy constructor
+     * \brief   Copy constructor. The copy is attached to the same observers
      */
     Subject(Subject &subject);
 
@@ -122,13 +176,16 @@ public:
     friend ostream &operator<<(ostream &outs, const Subject &observer);
 
 private:
-    // list of observers
+    // list of observers, only allocated once one is attached: most subjects (e.g. orders) are never observed
     list<Observer *> *_observers;
 };
 
 /**
  * \class   LogObserver
  * \brief   Class that inherits Observer interface that writes the logs to file
+ * \remarks Logs are appended to "gamelog.txt" by a background thread (see <code>AsyncLogWriter</code>), so that an
+ *          update costs little more than building the string to log. The file is truncated when the observer is
+ *          created; copies of the observer share it.
  */
 class LogObserver : public Observer
 {
@@ -149,10 +206,15 @@ public:
     ~LogObserver() override;
 
     /**
-     * \brief   Takes the string from ILoggable and write it to a file
+     * \brief   Takes the string from ILoggable and queues it to be written to the file
      */
     void Update(ILoggable *log) override;
 
+    /**
+     * \brief   Blocks until every string queued so far has been written to the file
+     */
+    void Flush() override;
+
     /**
      * \brief   Assigns new values to member variables of the ILoggable object
      * \param   ILoggable ILoggable object from which new values are to be taken
@@ -163,6 +225,10 @@ public:
      * \brief   Stream insertion override
      */
     friend ostream &operator<<(ostream &outs, const LogObserver &observer);
+
+private:
+    // writer of the log file, shared by copies of the observer
+    shared_ptr<AsyncLogWriter> writer;
 };
 
 #endif // LOGGING_OBSERVER_H
\ No newline at end of file
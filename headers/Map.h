@@ -10,7 +10,10 @@
 #endif
 
 #include <vector>
+#include <span>
 #include <string>
+#include <string_view>
+#include <functional>
 #include <fstream>
 #include <sstream>
 #include <unordered_map>
@@ -22,6 +25,7 @@
 
 //  Forward declaration of required classes from other header files. (included in .cpp file)
 class Player;
+class ThreadPool;
 
 // Forward declaration of classes
 class Continent;
@@ -29,6 +33,19 @@ class Territory;
 
 
 
+/** \brief Transparent string hash. Allows hash containers keyed by <code>std::string</code> to be queried with a
+ *         <code>std::string_view</code> (or string literal) without materialising a temporary string. */
+struct StringViewHash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view str) const noexcept { return std::hash<std::string_view>{}(str); }
+};
+
+/** \brief Name to index lookup table, supports heterogeneous <code>std::string_view</code> lookup. */
+using NameIndex = std::unordered_map<std::string, size_t, StringViewHash, std::equal_to<>>;
+
+
 /** \class Continent
  *  \brief Represents a continent in the game. */
 class Continent
@@ -37,7 +54,7 @@ public:
     /** \brief Constructs a Continent with the specified name and bonus value.
      *  \param name Name of the continent.
      *  \param bonusValue Bonus value associated with the continent. */
-    Continent(const std::string &name, int bonusValue);
+    Continent(std::string name, int bonusValue);
 
     /** \brief Copy constructor.
      *  \param other Other Continent to copy from. */
@@ -56,7 +73,7 @@ public:
 
     /** \brief Gets the name of the continent.
      *  \return Name of the continent. */
-    std::string getName() const;
+    const std::string &getName() const;
 
     /** \brief Gets the bonus value of the continent.
      *  \return Bonus value of the continent. */
@@ -67,10 +84,17 @@ public:
     void addTerritory(Territory *territory);
 
     /** \brief Gets the territories of the continent.
-     *  \return Vector of pointers to the territories. */
-    std::vector<Territory *> getTerritories() const;
+     *  \return Non-owning view of the territories, invalidated when a territory is added to the continent. */
+    std::span<Territory *const> getTerritories() const { return territories; }
+
+    /** \brief Gets the index of the continent within its map.
+     *  \return Index of the continent. */
+    size_t getId() const { return id; }
 
 private:
+    friend class Map;
+
+    size_t id = 0;    //Index of the continent within its map.
     std::string name; //Name of the continent.
     int bonus;       //Bonus value associated with the continent.
     std::vector<Territory *> territories; //Vector of territories in the continent.
@@ -92,7 +116,7 @@ public:
      * \param owner Pointer to the player who owns the territory (nullptr by default).
      * \param armies Number of armies in the territory (0 by default).
      */
-    Territory(const std::string &name, int xCoord, int yCoord, Continent *cont, Player * = nullptr, int armies = 0);
+    Territory(std::string name, int xCoord, int yCoord, Continent *cont, Player * = nullptr, int armies = 0);
 
     /** 
      * \brief Copy constructor.
@@ -121,7 +145,7 @@ public:
      * \brief Gets the name of the territory.
      * \return Name of the territory.
      */
-    std::string getName() const;
+    const std::string &getName() const;
 
     /**
      * \brief Adds an adjacent territory.
@@ -137,9 +161,10 @@ public:
 
     /** 
      * \brief Gets all adjacent territories.
-     * \return Vector of pointers to adjacent territories.
+     * \return Non-owning view of the adjacent territories. Once the territory is part of a map, the view points into
+     *         the map's contiguous adjacency storage and is invalidated if the map rebuilds its adjacency.
      */
-    std::vector<Territory *> getAdjacentTerritories() const;
+    std::span<Territory *const> getAdjacentTerritories() const { return adjacentTerritories; }
 
     /**
      * \brief Determines whether the specified territory is adjacent to the territory.
@@ -175,10 +200,20 @@ public:
     inline int getX() const { return x; }
     inline int getY() const {return y; }
 
+    /**
+     * \brief Gets the index of the territory within its map.
+     * \return Index of the territory.
+     */
+    size_t getId() const { return id; }
+
     int numberOfArmies;                           // Number of armies present in the territory.
-    std::vector<Territory *> adjacentTerritories; // Vector of territories adjacent to this territory.
 
 private:
+    friend class Map;
+
+    std::span<Territory *const> adjacentTerritories; // View of the territories adjacent to this territory.
+    std::vector<Territory *> ownedAdjacency;         // Adjacency storage used until the territory's map builds its CSR.
+    size_t id = 0;        // Index of the territory within its map.
     std::string name;     // Name of the territory.
     int x, y;             // Coordinates of the territory on the game map.
     Continent *continent; // Pointer to the continent the territory belongs to.
@@ -198,7 +233,7 @@ public:
     Map();
 
     /**
-     * \brief Destructor for Map.
+     * \brief Destructor for Map. Deletes the territories and continents of the map.
      */
     ~Map();
 
@@ -224,30 +259,60 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const Map &map);
 
     /**
-     * \brief Adds a territory to the map.
+     * \brief Adds a territory to the map, which takes ownership of it.
      * \param territory Pointer to the territory to be added.
      */
     void addTerritory(Territory *territory);
 
     /**
-     * \brief Adds a continent to the map.
+     * \brief Adds a continent to the map, which takes ownership of it.
      * \param continent Pointer to the continent to be added.
      */
     void addContinent(Continent *continent);
 
     /**
-     * \brief Gets a continent by its name.
+     * \brief Gets a continent by its name. Constant time lookup through the continent name index.
      * \param name Name of the continent to fetch.
      * \return Pointer to the continent, or nullptr if not found.
      */
-    Continent *getContinentByName(const std::string &name) const;
+    Continent *getContinentByName(std::string_view name) const;
 
     /**
-     * \brief Gets a territory by its name.
+     * \brief Gets a territory by its name. Constant time lookup through the territory name index.
      * \param name Name of the territory to fetch.
      * \return Pointer to the territory, or nullptr if not found.
      */
-    Territory *getTerritoryByName(const std::string &name) const;
+    Territory *getTerritoryByName(std::string_view name) const;
+
+    /**
+     * \brief Packs the adjacency of every territory into the map's compressed sparse row storage and rebinds each
+     *        territory's adjacency view to it. Called once all adjacencies have been linked.
+     */
+    void buildAdjacency();
+
+    /**
+     * \brief Adopts an already packed adjacency and rebinds each territory's adjacency view to it.
+     * \param offsets CSR offsets, one more than the number of territories.
+     * \param neighbours Concatenated neighbours of every territory, in territory id order.
+     */
+    void setAdjacency(std::vector<size_t> offsets, std::vector<Territory *> neighbours);
+
+    /**
+     * \brief Gets the territories adjacent to the territory with the given index, straight from the CSR storage.
+     * \param territoryId Index of the territory.
+     * \return Non-owning view of the adjacent territories.
+     */
+    std::span<Territory *const> getAdjacentTerritories(size_t territoryId) const
+    {
+        return {adjacency.data() + adjacencyOffsets[territoryId], adjacency.data() + adjacencyOffsets[territoryId + 1]};
+    }
+
+    /**
+     * \brief Reserves space for the given number of continents and territories, including their name indices.
+     * \param numContinents Expected number of continents.
+     * \param numTerritories Expected number of territories.
+     */
+    void reserve(size_t numContinents, size_t numTerritories);
 
     /**
      * \brief Retrieves all continents in the map.
@@ -260,13 +325,15 @@ public:
      *        1) the map is a connected graph, 
      *        2) continents are connected sub-graphs
      *        3) each country belongs to one and only one continent
+     *        Runs in O(V + E). Every failing territory and continent is reported on the error stream.
      * \return True if the map is valid, false otherwise.
      */
     bool validate() const;
 
     /**
-     * \brief Helper to validate(): Checks if a territory is connected to a list of territories.
-     * \param territory Territory to check.
+     * \brief Checks if every territory of a list can be reached from a territory, only passing through territories
+     *        of that list.
+     * \param territory Territory to start from.
      * \param territoryList List of territories to check against.
      * \return True if the territory is connected, false otherwise.
      */
@@ -304,20 +371,31 @@ public:
     /**
      * \brief Gets the all the territories in the map.
      */
-    std::vector<Territory *> getTerritories() const;
+    const std::vector<Territory *> &getTerritories() const { return territories; }
 
 private:
     std::vector<Continent *> continents;    // Vector of continents present in the map.
     std::vector<Territory *> territories;   // Vector of territories present in the map.
+    NameIndex continentIndex;               // Continent name -> index into 'continents'.
+    NameIndex territoryIndex;               // Territory name -> index into 'territories'.
     bool isValid = true;                    // Flag indicating if the map is valid.
 
+    //  Compressed sparse row adjacency: the neighbours of territory 'i' are
+    //  adjacency[adjacencyOffsets[i]] .. adjacency[adjacencyOffsets[i + 1] - 1]
+    std::vector<size_t> adjacencyOffsets = {0};
+    std::vector<Territory *> adjacency;
+
     /**
-     * \brief Helper to isConnected(): Checks if a territory exists in a given list.
-     * \param territory Territory to check.
-     * \param territoryList List of territories to check against.
-     * \return True if territory exists in the list, false otherwise.
+     * \brief Helper to the copy constructor and assignment operator: deep copies the continents, territories and
+     *        adjacency of another map, re-pointing every internal reference to the new objects.
+     * \param other Map to copy from.
      */
-    bool territoryExistsInList(const Territory *territory, const std::vector<Territory *> &territoryList) const;
+    void copyFrom(const Map &other);
+
+    /**
+     * \brief Rebuilds both name indices from the current continents and territories.
+     */
+    void rebuildNameIndices();
 };
 
 
@@ -328,11 +406,24 @@ private:
 class MapLoader
 {
 public:
+    /**
+     * \brief How the map file is brought into memory before being tokenized.
+     */
+    enum class Mode
+    {
+        Buffered,       /**< The file is read into a single heap buffer. */
+        MemoryMapped,   /**< The file is memory mapped and tokenized in place. */
+        Parallel        /**< The file is memory mapped, and its [Territories] section is tokenized in chunks and its
+                             adjacency resolved on a thread pool. Meant for very large (generated) maps. */
+    };
+
     /**
      * \brief Constructor that takes a file path as parameter.
      * \param filePath Path to the map file to be loaded.
+     * \param mode How the file is brought into memory. Memory mapped by default.
+     * \param numThreads Number of threads used by <code>Mode::Parallel</code>. 0 uses the number of hardware threads.
      */
-    explicit MapLoader(const std::string &filePath);
+    explicit MapLoader(const std::string &filePath, Mode mode = Mode::MemoryMapped, unsigned numThreads = 0);
 
     /**
      * \brief Copy constructor.
@@ -362,39 +453,136 @@ public:
     Map *load();
 
     /**
-     * \brief Links adjacent territories in the provided Map object.
+     * \brief Links adjacent territories in the provided Map object, building the map's CSR adjacency.
+     * \remarks Resolves the adjacency names recorded while parsing, which are views into the file contents. Only
+     *          meaningful while <code>load()</code> is running.
      * \param map The Map object where territories need to be linked.
      */
     void linkAdjacentTerritories(Map &map);
 
+    /**
+     * \brief Links adjacent territories like <code>linkAdjacentTerritories(Map&)</code>, resolving the adjacency
+     *        names on the given thread pool.
+     * \param map The Map object where territories need to be linked.
+     * \param pool Thread pool resolving the names.
+     */
+    void linkAdjacentTerritories(Map &map, ThreadPool &pool);
+
+    /**
+     * \brief Loads a game map from a precompiled binary map file (see <code>writeBinary</code>).
+     * \remarks The file is mapped once and the map is built straight from its tables: no text parsing and no
+     *          adjacency resolution by name.
+     * \param binaryPath Path to the binary map file.
+     * \return Pointer to the loaded Map object, or nullptr if the file is missing, truncated or not a binary map.
+     */
+    static Map *loadBinary(const std::string &binaryPath);
+
+    /**
+     * \brief Writes a map in the compact binary map format: a header, the continent and territory tables, the CSR
+     *        adjacency and a string table holding every name.
+     * \param map The Map object to be written.
+     * \param binaryPath Path of the binary map file to write.
+     * \return True if the file was written, false otherwise.
+     */
+    static bool writeBinary(const Map &map, const std::string &binaryPath);
+
+    /**
+     * \brief Gets the path of the binary sidecar file of a .map file.
+     * \param mapPath Path to the .map file.
+     * \return Path of the binary sidecar.
+     */
+    static std::string binaryPathFor(const std::string &mapPath);
+
+    /**
+     * \brief Checks whether a binary sidecar exists and is at least as recent as the .map file it was compiled from.
+     * \param mapPath Path to the .map file.
+     * \param binaryPath Path to the binary sidecar.
+     * \return True if the sidecar can be used in place of the .map file.
+     */
+    static bool isBinaryUpToDate(const std::string &mapPath, const std::string &binaryPath);
+
 private:
     std::string filePath;  /**< Path to the map file. */
+    Mode mode;             /**< How the file is brought into memory. */
+    unsigned numThreads;   /**< Number of threads used by Mode::Parallel, 0 for the number of hardware threads. */
+
+    /**
+     * \brief Territories parsed from one chunk of the [Territories] section, before they are added to the map.
+     */
+    struct TerritoryChunk
+    {
+        std::vector<Territory *> territories;           /**< Parsed territories, in file order. */
+        std::vector<std::string_view> adjacencyNames;   /**< Adjacency names of every parsed territory. */
+        std::vector<size_t> adjacencyOffsets = {0};     /**< CSR offsets of each territory into adjacencyNames. */
+        std::ostringstream errors;                      /**< Errors, printed in file order once chunks are merged. */
+    };
     
     /**
      * \brief Helper function to trim whitespace and carriage return from strings.
      * \param str String to be trimmed.
-     * \return Trimmed string.
+     * \return Trimmed view of the same characters.
      */
-    std::string trim(const std::string &str);
+    static std::string_view trim(std::string_view str);
 
     /**
-     * \brief Container to store parsed territory adjacencies.
+     * \brief Parsed territory adjacencies, stored as views into the file contents: the adjacency names of the
+     *        territory with id 'i' are adjacencyNames[adjacencyNameOffsets[i]] .. [adjacencyNameOffsets[i + 1] - 1].
      */
-    std::unordered_map<std::string, std::vector<std::string>> parsedTerritoryAdjacencies;
+    std::vector<std::string_view> adjacencyNames;
+    std::vector<size_t> adjacencyNameOffsets;
+
+    /**
+     * \brief Tokenizes the whole contents of a map file into the Map object.
+     * \param contents Contents of the map file.
+     * \param map The Map object to be updated.
+     * \return False if the [Continents] or [Territories] section is missing.
+     */
+    bool parse(std::string_view contents, Map &map);
+
+    /**
+     * \brief Tokenizes the whole contents of a map file into the Map object, parsing the [Territories] section in
+     *        chunks on a thread pool. Produces the same Map object as <code>parse(...)</code>.
+     * \param contents Contents of the map file.
+     * \param map The Map object to be updated.
+     * \param pool Thread pool parsing the chunks.
+     * \return False if the [Continents] or [Territories] section is missing.
+     */
+    bool parseParallel(std::string_view contents, Map &map, ThreadPool &pool);
+
+    /**
+     * \brief Splits the body of a [Territories] section into chunks at line boundaries, parses them on the thread
+     *        pool and merges them into the Map object in file order.
+     * \param section Body of the [Territories] section.
+     * \param map The Map object to be updated.
+     * \param pool Thread pool parsing the chunks.
+     */
+    void parseTerritorySection(std::string_view section, Map &map, ThreadPool &pool);
 
     /**
      * \brief Helper function to parse continent data from a line and update the Map object.
      * \param line Line from the file containing continent data.
      * \param map The Map object to be updated.
      */
-    void parseContinentLine(const std::string &line, Map &map);
+    void parseContinentLine(std::string_view line, Map &map);
 
     /**
      * \brief Helper function to parse territory data from a line and update the Map object.
      * \param line Line from the file containing territory data.
      * \param map The Map object to be updated.
      */
-    void parseTerritoryLine(const std::string &line, Map &map);
+    void parseTerritoryLine(std::string_view line, Map &map);
+
+    /**
+     * \brief Parses territory data from a line without updating the Map object, so that lines can be parsed
+     *        concurrently.
+     * \param line Line from the file containing territory data.
+     * \param map The Map object, only used to look up continents.
+     * \param errors Stream that parsing errors are reported to.
+     * \param adjacencyNames Receives the adjacency names of the territory, as views into the line.
+     * \return The new territory, not yet added to its continent or the map, or nullptr if the line holds none.
+     */
+    static Territory *parseTerritoryRecord(std::string_view line, const Map &map, std::ostream &errors,
+                                           std::vector<std::string_view> &adjacencyNames);
 };
 
 #ifdef __GNUC__
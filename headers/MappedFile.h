@@ -0,0 +1,68 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+//  Compiler specific macros
+//  Disables clang modernize suggestions
+#ifdef __GNUC__
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "modernize-use-nodiscard"
+#endif
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+/** \class MappedFile
+ *  \brief Read-only memory mapping of a whole file. The file contents are exposed as a <code>std::string_view</code>
+ *         over the mapped pages, so parsers can tokenize them without copying.
+ *  \remarks Move-only. The mapping is released when the object is destroyed; views obtained from it must not outlive
+ *           it. */
+class MappedFile
+{
+public:
+    /** \brief Constructs an empty (closed) mapping. */
+    MappedFile() = default;
+
+    /** \brief Maps the file at the given path. Check <code>isOpen()</code> for success. */
+    explicit MappedFile(const std::string &filePath);
+
+    /** \brief Unmaps the file. */
+    ~MappedFile();
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    //  Deleted members
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /** \brief Maps the file at the given path, releasing any previous mapping.
+     *  \return True if the file could be opened and mapped, false otherwise. */
+    bool open(const std::string &filePath);
+
+    /** \brief Releases the mapping. */
+    void close();
+
+    /** \brief Returns whether a file is currently mapped. An empty file counts as open, with a size of 0. */
+    bool isOpen() const noexcept { return opened; }
+
+    /** \brief Returns a pointer to the first mapped byte. */
+    const char *data() const noexcept { return begin; }
+
+    /** \brief Returns the number of mapped bytes. */
+    size_t size() const noexcept { return length; }
+
+    /** \brief Returns the whole file as a view over the mapped bytes. */
+    std::string_view view() const noexcept { return {begin, length}; }
+
+private:
+    const char *begin = nullptr;
+    size_t length = 0;
+    bool opened = false;
+};
+
+#ifdef __GNUC__
+#pragma clang diagnostic pop
+#endif
+
+#endif // MAPPED_FILE_H
@@ -2,9 +2,10 @@
 #define ORDERS_H
 
 #include <string>
-#include <list>
+#include <variant>
 #include <iostream>
 #include "LoggingObserver.h"
+#include "RingBuffer.h"
 
 //  Forward declaration of required classes from other header files. (included in .cpp file)
 class Territory; //  Map.h
@@ -12,6 +13,23 @@ class Player;    //  Player.h
 
 using namespace std;
 
+class Order;
+struct DeployAction;
+struct AdvanceAction;
+struct BombAction;
+struct BlockadeAction;
+struct AirliftAction;
+struct NegotiateAction;
+
+/**
+ * \brief   An order as an <code>OrdersList</code> stores it: the plain values of one of the six orders, or an
+ *          <code>Order</code> object added to the list as such, that the list then owns.
+ * \remarks Orders are issued and executed as values, without any allocation or virtual call: validating and executing
+ *          one dispatches on the alternative through <code>std::visit</code>. An <code>Order</code> object is only made
+ *          when code asks the list for one.
+ */
+using CompactOrder = std::variant<DeployAction, AdvanceAction, BombAction, BlockadeAction, AirliftAction, NegotiateAction, Order *>;
+
 /**
  * \class   Order
  * \brief   A class that represents an order
@@ -105,6 +123,17 @@ public:
 
     inline Order::OrderType getOrderType() const noexcept { return type; }
 
+    /**
+     * \brief   Describes the executed order for the binary event log: its type, owner and target. Orders moving armies
+     *          add their own details
+     */
+    LogEntry toLogEntry() override;
+
+    /**
+     * \brief   Returns the values of the order, as an orders list stores them
+     */
+    virtual CompactOrder compact() const = 0;
+
 protected:
     //  Pointer to the player that owns the object
     Player *owner;
@@ -114,6 +143,122 @@ protected:
     Territory *target;
 };
 
+/**
+ * \brief   Values of a deploy order. The value types of the orders hold the rules of the orders, shared by the
+ *          <code>Order</code> classes: <code>validate</code> checks them, <code>apply</code> carries out a valid order.
+ *          The owner of the order is the owner of the list holding it
+ */
+struct DeployAction
+{
+    static constexpr Order::OrderType type = Order::OrderType::Deploy;
+
+    Territory *target;
+    int armyUnits;
+
+    bool validate(Player *owner) const;
+    void apply(Player *owner) const;
+    Order *toOrder(Player *owner) const;
+    string describe() const;
+    LogEntry toLogEntry(Player *owner) const;
+    friend ostream &operator<<(ostream &outs, const DeployAction &action);
+};
+
+/**
+ * \brief   Values of an advance order. <code>apply</code> returns whether the target was conquered
+ */
+struct AdvanceAction
+{
+    static constexpr Order::OrderType type = Order::OrderType::Advance;
+
+    Territory *target;
+    Territory *source;
+    int armyUnits;
+
+    bool validate(Player *owner) const;
+    bool apply(Player *owner) const;
+    Order *toOrder(Player *owner) const;
+    string describe() const;
+    LogEntry toLogEntry(Player *owner) const;
+    friend ostream &operator<<(ostream &outs, const AdvanceAction &action);
+};
+
+/**
+ * \brief   Values of a bomb order
+ */
+struct BombAction
+{
+    static constexpr Order::OrderType type = Order::OrderType::Bomb;
+
+    Territory *target;
+
+    bool validate(Player *owner) const;
+    void apply(Player *owner) const;
+    Order *toOrder(Player *owner) const;
+    string describe() const;
+    LogEntry toLogEntry(Player *owner) const;
+    friend ostream &operator<<(ostream &outs, const BombAction &action);
+};
+
+/**
+ * \brief   Values of a blockade order
+ */
+struct BlockadeAction
+{
+    static constexpr Order::OrderType type = Order::OrderType::Blockade;
+
+    Territory *target;
+
+    bool validate(Player *owner) const;
+    void apply(Player *owner) const;
+    Order *toOrder(Player *owner) const;
+    string describe() const;
+    LogEntry toLogEntry(Player *owner) const;
+    friend ostream &operator<<(ostream &outs, const BlockadeAction &action);
+};
+
+/**
+ * \brief   Values of an airlift order
+ */
+struct AirliftAction
+{
+    static constexpr Order::OrderType type = Order::OrderType::Airlift;
+
+    Territory *target;
+    Territory *source;
+    int armyUnits;
+
+    bool validate(Player *owner) const;
+    void apply(Player *owner) const;
+    Order *toOrder(Player *owner) const;
+    string describe() const;
+    LogEntry toLogEntry(Player *owner) const;
+    friend ostream &operator<<(ostream &outs, const AirliftAction &action);
+};
+
+/**
+ * \brief   Values of a negotiate order
+ */
+struct NegotiateAction
+{
+    static constexpr Order::OrderType type = Order::OrderType::Negotiate;
+
+    Player *player;
+
+    bool validate(Player *owner) const;
+    void apply(Player *owner) const;
+    Order *toOrder(Player *owner) const;
+    string describe() const;
+    LogEntry toLogEntry(Player *owner) const;
+    friend ostream &operator<<(ostream &outs, const NegotiateAction &action);
+};
+
+static_assert(sizeof(CompactOrder) <= 32, "Orders are stored inline in orders lists: keep them small");
+
+/**
+ * \brief   Returns the type of a stored order
+ */
+Order::OrderType orderTypeOf(const CompactOrder &order);
+
 /**
  * \class   OrdersList
  * \brief   Class that holds the list of Order objects of each player
@@ -133,18 +278,55 @@ public:
     OrdersList(OrdersList &ordersList);
 
     /**
-     * \brief   Appends a pointer to the end of the orders list - if it is not null
+     * \brief   Constructs an OrdersList object with copies of the orders of another OrdersList object, issued by another
+     *          owner: they are validated and executed as the new owner's
+     * \param   ordersList Other OrdersList object to copy the orders from
+     * \param   owner Owner of the new list
+     */
+    OrdersList(const OrdersList &ordersList, Player *owner);
+
+    /**
+     * \brief   Deletes the Order objects still in the list
+     */
+    ~OrdersList() override;
+
+    /**
+     * \brief   Appends a pointer to the end of the orders list - if it is not null. The list takes ownership of it
      * \param order Pointer to an Order object
      * \return  Returns true if append was successful, false otherwise
      */
     bool addOrder(Order *order);
 
     /**
-     * \brief   Pops the head pointer in the list
-     * \return  Pointer to an Order object; head of the list
+     * \brief   Appends an order to the end of the orders list, stored inline
+     * \param order The values of the order
+     * \return  Returns true if append was successful, false otherwise
+     */
+    bool addOrder(const CompactOrder &order);
+
+    /**
+     * \brief   Pops the head of the list
+     * \return  Pointer to an Order object, owned by the caller; head of the list. nullptr if the list is empty
      */
     Order *getNextOrder();
 
+    /**
+     * \brief   Pops the head of the list and executes it, without making an Order object for it
+     * \return  False if the list was empty, true otherwise
+     */
+    bool executeNextOrder();
+
+    /**
+     * \brief   Gets the type of the head of the list, without popping it. The list must not be empty
+     */
+    Order::OrderType nextOrderType() const;
+
+    /**
+     * \brief   Moves the deploy orders to the head of the list, keeping the order they were issued in
+     * \return  The number of deploy orders in the list
+     */
+    size_t moveDeployOrdersFirst();
+
     /**
      * \brief   Gets the owner
      * \return  Pointer to a player object
@@ -155,7 +337,7 @@ public:
      * \brief   Takes in a function, then applies that function to each order in the list
      * \param func  Function to apply to each Order element in the list
      * \remarks Solution to external iteration. Now iteration can occur internally through passing of a function.
-     *          Upholds encapsulation.
+     *          Upholds encapsulation. Orders stored inline are replaced by Order objects first
      */
     void apply(void (*func)(Order *));
 
@@ -174,19 +356,37 @@ public:
      */
     bool move(Order *order, int index);
 
+    /**
+     * \brief   Moves the order at position 'from' to position 'to', shifting the orders between in place
+     * \return  True if order moving is successful, false if a position is out of the list
+     */
+    bool reorder(size_t from, size_t to);
+
     /**
      * \brief   Creates and return string for logging
      * \return  The string
      */
     string stringToLog();
 
+    /**
+     * \brief   Describes the last issued order for the binary event log
+     */
+    LogEntry toLogEntry() override;
+
     /**
      * \brief Returns size of the list of Order objects
      */
     int size() const { return orders.size(); };
 
     /**
-     * \brief   Directly accesses the internal orders list
+     * \brief   Returns the number of Order objects the list has made so far for orders stored inline
+     * \remarks Executing orders never makes one; only the Order based accessors (operator[], getNextOrder and apply)
+     *          do
+     */
+    size_t getOrdersBoxed() const { return ordersBoxed; }
+
+    /**
+     * \brief   Directly accesses the internal orders list, in constant time
      * \param index Index of internal list
      * \return  Returns a Order pointer using the passed index. Returns nullptr if invalid index.
      */
@@ -204,10 +404,15 @@ public:
     friend ostream &operator<<(ostream &outs, const OrdersList &ordersList);
 
 private:
-    // List of pointers to Order objects
-    list<Order *> orders;
+    // Orders, in the order they are to be executed. Drained every turn, the buffer keeps its capacity for the next
+    RingBuffer<CompactOrder> orders;
     // Owner of orders list
     Player *owner;
+    // Number of Order objects made by box
+    size_t ordersBoxed = 0;
+
+    // Replaces an order stored inline by an Order object, owned by the list, and returns it
+    Order *box(CompactOrder &order);
 };
 
 /**
@@ -269,6 +474,18 @@ public:
      */
     string stringToLog();
 
+    /**
+     * \brief   Describes the executed order for the binary event log
+     */
+    LogEntry toLogEntry() override;
+
+    /**
+     * \brief   Returns the values of the order
+     */
+    DeployAction action() const;
+
+    CompactOrder compact() const override;
+
 private:
     // Number of army units to deploy
     int armyUnits;
@@ -328,6 +545,18 @@ public:
      */
     string stringToLog();
 
+    /**
+     * \brief   Describes the executed order for the binary event log
+     */
+    LogEntry toLogEntry() override;
+
+    /**
+     * \brief   Returns the values of the order
+     */
+    AdvanceAction action() const;
+
+    CompactOrder compact() const override;
+
 private:
     // Number of army units to move
     int armyUnits;
@@ -385,6 +614,13 @@ public:
      * \brief   Creates the string to log
      */
     string stringToLog();
+
+    /**
+     * \brief   Returns the values of the order
+     */
+    BombAction action() const;
+
+    CompactOrder compact() const override;
 };
 
 /**
@@ -437,6 +673,13 @@ public:
      * \brief   Creates the string to log
      */
     string stringToLog();
+
+    /**
+     * \brief   Returns the values of the order
+     */
+    BlockadeAction action() const;
+
+    CompactOrder compact() const override;
 };
 
 /**
@@ -492,6 +735,18 @@ public:
      */
     string stringToLog();
 
+    /**
+     * \brief   Describes the executed order for the binary event log
+     */
+    LogEntry toLogEntry() override;
+
+    /**
+     * \brief   Returns the values of the order
+     */
+    AirliftAction action() const;
+
+    CompactOrder compact() const override;
+
 private:
     // Number of army units advanced
     int armyUnits;
@@ -550,6 +805,18 @@ public:
      */
     string stringToLog();
 
+    /**
+     * \brief   Describes the executed order for the binary event log
+     */
+    LogEntry toLogEntry() override;
+
+    /**
+     * \brief   Returns the values of the order
+     */
+    NegotiateAction action() const;
+
+    CompactOrder compact() const override;
+
 private:
     // Player with whom attacks are prevented during current turn
     Player *player;
@@ -0,0 +1,126 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+//  Compiler specific macros
+//  Disables clang modernize suggestions
+#ifdef __GNUC__
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "modernize-use-nodiscard"
+#endif
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+/** \class Random
+ *  \brief Fast, seedable pseudo-random number generator (xoshiro256**). Every game owns one, so that a game played
+ *         from the same seed makes the same random choices.
+ *  \remarks Satisfies <i>UniformRandomBitGenerator</i>, so it can drive <code>std::shuffle</code> and the standard
+ *           distributions. Not thread-safe: each game, and so each thread, uses its own generator. */
+class Random
+{
+public:
+    using result_type = std::uint64_t;
+
+    /** \brief Creates a generator from the given seed. Any seed, including 0, gives a full-quality sequence. */
+    explicit Random(std::uint64_t seed = randomSeed());
+
+    /** \brief Restarts the sequence of the generator from the given seed. */
+    void seed(std::uint64_t seed);
+
+    /** \brief Returns the next 64 random bits. */
+    result_type operator()()
+    {
+        const std::uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+        const std::uint64_t shifted = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= shifted;
+        state[3] = rotateLeft(state[3], 45);
+
+        return result;
+    }
+
+    /** \brief Returns a uniformly distributed index in [0, bound). <code>bound</code> must not be 0. */
+    std::size_t nextIndex(std::size_t bound)
+    {
+        //  Lemire's multiply-shift, rejecting the few values that would bias the result
+        const auto range = static_cast<std::uint64_t>(bound);
+        std::uint64_t low;
+        std::uint64_t high = multiply((*this)(), range, low);
+        if (low < range)
+        {
+            const std::uint64_t threshold = -range % range;
+            while (low < threshold)
+                high = multiply((*this)(), range, low);
+        }
+        return static_cast<std::size_t>(high);
+    }
+
+    /** \brief Returns a uniformly distributed number in [0, 1). */
+    double nextDouble()
+    {
+        return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+    }
+
+    /** \brief Returns true with the given probability. */
+    bool nextChance(double probability)
+    {
+        return nextDouble() < probability;
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    /** \brief Returns a non-deterministic seed, for games that were not given one. */
+    static std::uint64_t randomSeed();
+
+    /** \brief Returns the generator of the calling thread, randomly seeded. Used by objects not taking part in a game
+     *         (e.g. players created by the drivers). */
+    static Random &threadDefault();
+
+private:
+    std::uint64_t state[4] = {};
+
+    static std::uint64_t rotateLeft(std::uint64_t value, int bits)
+    {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    //  Full 128 bit product of two 64 bit numbers: returns the high half, and stores the low half
+    static std::uint64_t multiply(std::uint64_t a, std::uint64_t b, std::uint64_t &low)
+    {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        low = static_cast<std::uint64_t>(product);
+        return static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        std::uint64_t high;
+        low = _umul128(a, b, &high);
+        return high;
+#else
+        //  Schoolbook multiplication on 32 bit halves
+        const std::uint64_t aLow = a & 0xffffffff, aHigh = a >> 32;
+        const std::uint64_t bLow = b & 0xffffffff, bHigh = b >> 32;
+        const std::uint64_t lowLow = aLow * bLow;
+        const std::uint64_t highLow = aHigh * bLow;
+        const std::uint64_t lowHigh = aLow * bHigh;
+        const std::uint64_t middle = (lowLow >> 32) + (highLow & 0xffffffff) + lowHigh;
+        low = (middle << 32) | (lowLow & 0xffffffff);
+        return aHigh * bHigh + (highLow >> 32) + (middle >> 32);
+#endif
+    }
+};
+
+#ifdef __GNUC__
+#pragma clang diagnostic pop
+#endif
+
+#endif // RANDOM_H
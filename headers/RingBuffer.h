@@ -0,0 +1,218 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/** \class RingBuffer
+ *  \brief A double-ended queue kept in one contiguous, circular block of memory: O(1) push/pop at both ends and O(1)
+ *         indexed access.
+ *  \remarks The capacity is a power of two and doubles when full; it never shrinks, so a queue that is filled and
+ *           drained every turn stops allocating once it has grown to its busiest turn. Elements must be default
+ *           constructible and copyable: the block holds <code>capacity()</code> of them at all times. Inserting,
+ *           erasing or moving an element in the middle shifts the elements between, in place. */
+template <typename T>
+class RingBuffer
+{
+public:
+    /** \brief Iterator over the elements, front to back. */
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+        using Buffer = std::conditional_t<Const, const RingBuffer, RingBuffer>;
+
+        Iterator() = default;
+        Iterator(Buffer *buffer, size_t index) : buffer(buffer), index(index) {}
+
+        reference operator*() const { return (*buffer)[index]; }
+        pointer operator->() const { return &(*buffer)[index]; }
+
+        Iterator &operator++()
+        {
+            index++;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            index++;
+            return previous;
+        }
+
+        bool operator==(const Iterator &other) const { return index == other.index; }
+        bool operator!=(const Iterator &other) const { return index != other.index; }
+
+        /** \brief Returns the position of the element, counted from the front. */
+        size_t position() const noexcept { return index; }
+
+    private:
+        Buffer *buffer = nullptr;
+        size_t index = 0;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    /** \brief Constructs an empty buffer. Nothing is allocated until the first element is added. */
+    RingBuffer() = default;
+
+    /** \brief Returns the number of elements. */
+    size_t size() const noexcept { return count; }
+
+    /** \brief Returns whether the buffer holds no element. */
+    bool empty() const noexcept { return count == 0; }
+
+    /** \brief Returns the number of elements the buffer holds before growing. */
+    size_t capacity() const noexcept { return slots.size(); }
+
+    /** \brief Returns the element at the given position, counted from the front. */
+    T &operator[](size_t index) noexcept { return slots[(head + index) & mask]; }
+    const T &operator[](size_t index) const noexcept { return slots[(head + index) & mask]; }
+
+    T &front() noexcept { return slots[head]; }
+    const T &front() const noexcept { return slots[head]; }
+    T &back() noexcept { return (*this)[count - 1]; }
+    const T &back() const noexcept { return (*this)[count - 1]; }
+
+    iterator begin() noexcept { return {this, 0}; }
+    iterator end() noexcept { return {this, count}; }
+    const_iterator begin() const noexcept { return {this, 0}; }
+    const_iterator end() const noexcept { return {this, count}; }
+
+    /** \brief Appends an element. */
+    void push_back(const T &value)
+    {
+        if (count == slots.size())
+            grow();
+        slots[(head + count) & mask] = value;
+        count++;
+    }
+
+    /** \brief Prepends an element. */
+    void push_front(const T &value)
+    {
+        if (count == slots.size())
+            grow();
+        head = (head - 1) & mask;
+        slots[head] = value;
+        count++;
+    }
+
+    /** \brief Removes the first element. The buffer must not be empty. */
+    void pop_front() noexcept
+    {
+        head = (head + 1) & mask;
+        count--;
+    }
+
+    /** \brief Removes the last element. The buffer must not be empty. */
+    void pop_back() noexcept { count--; }
+
+    /** \brief Removes every element, keeping the capacity. */
+    void clear() noexcept
+    {
+        head = 0;
+        count = 0;
+    }
+
+    /** \brief Inserts an element before the given position (<code>size()</code> appends it). */
+    void insert(size_t index, const T &value)
+    {
+        push_back(value);
+        moveTo(count - 1, index);
+    }
+
+    /** \brief Removes the element at the given position. */
+    void erase(size_t index)
+    {
+        moveTo(index, count - 1);
+        pop_back();
+    }
+
+    /** \brief Moves the element at position <code>from</code> to position <code>to</code>, shifting the elements
+     *         between by one place. */
+    void moveTo(size_t from, size_t to)
+    {
+        T moving = std::move((*this)[from]);
+        for (; from < to; from++)
+            (*this)[from] = std::move((*this)[from + 1]);
+        for (; from > to; from--)
+            (*this)[from] = std::move((*this)[from - 1]);
+        (*this)[to] = std::move(moving);
+    }
+
+    /** \brief Reorders the elements so that those satisfying <code>predicate</code> come first, keeping the relative
+     *         order within both groups.
+     *  \return The number of elements satisfying <code>predicate</code>.
+     *  \remarks Works in place, without allocating: halves are partitioned in turn, then the elements of the left half
+     *           not satisfying <code>predicate</code> are swapped past those of the right half that do, in
+     *           O(n log n) swaps. Elements already first or last are not moved. */
+    template <typename Predicate>
+    size_t stablePartition(Predicate predicate)
+    {
+        size_t kept = 0;
+        while (kept < count && predicate((*this)[kept]))
+            kept++;
+        size_t last = count;
+        while (last > kept && !predicate((*this)[last - 1]))
+            last--;
+        return partitionRange(kept, last, predicate);
+    }
+
+private:
+    std::vector<T> slots;
+    size_t head = 0;
+    size_t count = 0;
+    size_t mask = 0;
+
+    //  Stable partition of the elements in [first, last), returning the end of those satisfying the predicate
+    template <typename Predicate>
+    size_t partitionRange(size_t first, size_t last, Predicate &predicate)
+    {
+        if (last - first <= 1)
+            return first != last && predicate((*this)[first]) ? last : first;
+        size_t middle = first + (last - first) / 2;
+        size_t leftEnd = partitionRange(first, middle, predicate);
+        size_t rightEnd = partitionRange(middle, last, predicate);
+        rotate(leftEnd, middle, rightEnd);
+        return leftEnd + (rightEnd - middle);
+    }
+
+    //  Swaps the elements of [first, middle) with those of [middle, last), keeping the order within both
+    void rotate(size_t first, size_t middle, size_t last)
+    {
+        reverse(first, middle);
+        reverse(middle, last);
+        reverse(first, last);
+    }
+
+    void reverse(size_t first, size_t last)
+    {
+        using std::swap;
+        for (; first + 1 < last; first++, last--)
+            swap((*this)[first], (*this)[last - 1]);
+    }
+
+    //  Doubles the capacity, unwrapping the elements to the start of the new block
+    void grow()
+    {
+        std::vector<T> larger(slots.empty() ? 16 : slots.size() * 2);
+        for (size_t i = 0; i < count; i++)
+            larger[i] = std::move((*this)[i]);
+        slots = std::move(larger);
+        head = 0;
+        mask = slots.size() - 1;
+    }
+};
+
+#endif // RING_BUFFER_H
@@ -0,0 +1,80 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+//  Compiler specific macros
+//  Disables clang modernize suggestions
+#ifdef __GNUC__
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "modernize-use-nodiscard"
+#endif
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+/** \class ThreadPool
+ *  \brief Fixed-size pool of worker threads executing submitted tasks in FIFO order.
+ *  \remarks Tasks are submitted with <code>submit(...)</code>, which returns a <code>std::future</code> holding the
+ *           task's result (or the exception it threw). The destructor finishes every queued task before joining the
+ *           workers. Not copyable or movable. */
+class ThreadPool
+{
+public:
+    /** \brief Starts the given number of worker threads.
+     *  \param numThreads Number of workers. 0 uses the number of hardware threads. */
+    explicit ThreadPool(unsigned numThreads = 0);
+
+    /** \brief Runs every queued task, then joins the workers. */
+    ~ThreadPool();
+
+    //  Deleted members
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /** \brief Returns the number of worker threads. */
+    size_t size() const noexcept { return workers.size(); }
+
+    /** \brief Queues a task for execution on one of the workers.
+     *  \param task Callable taking no arguments.
+     *  \return Future for the task's result. */
+    template <typename F>
+    std::future<std::invoke_result_t<std::decay_t<F>>> submit(F &&task)
+    {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+
+        //  'std::function' requires copyable callables, so the packaged task is shared
+        auto packagedTask = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> result = packagedTask->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.emplace([packagedTask]() { (*packagedTask)(); });
+        }
+        available.notify_one();
+        return result;
+    }
+
+    /** \brief Returns the number of hardware threads, at least 1. */
+    static unsigned hardwareThreads() noexcept;
+
+private:
+    /** \brief Worker loop: runs queued tasks until the pool is stopped and the queue is drained. */
+    void run();
+
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable available;
+    bool stopping = false;
+};
+
+#ifdef __GNUC__
+#pragma clang diagnostic pop
+#endif
+
+#endif // THREAD_POOL_H
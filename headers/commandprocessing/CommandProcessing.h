@@ -116,6 +116,10 @@ public:
     /** \brief Returns a deep copy of the object. */
     virtual CommandProcessor* clone() const noexcept = 0;
 
+    /** \brief Returns whether the processor has run out of non-interactive commands, meaning the next command would
+     *         have to be typed in by a user. Interactive processors are never exhausted. */
+    virtual bool isExhausted() const { return false; }
+
     //  Other methods
     /** \brief Determines if a command is valid given the current state.
      *  \remarks Only tests if the command if it is syntactically valid, which does not guarantee that the command will
@@ -44,6 +44,9 @@ public:
     /** \brief Returns a deep copy of the object. */
     FileCommandProcessorAdapter* clone() const noexcept override;
 
+    /** \brief Returns whether every command from the file has been taken. */
+    bool isExhausted() const override;
+
 private:
     //  A queue of commands.
     std::queue<Command> commandQueue;
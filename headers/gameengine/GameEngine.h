@@ -9,12 +9,17 @@
 #pragma ide diagnostic ignored "OCUnusedGlobalDeclarationInspection"
 #endif
 
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
 #include "State.h"
 #include "../LoggingObserver.h"
+#include "../Cards.h"
+#include "../Random.h"
+#include "NegotiationMatrix.h"
 
 //  Forward declaration of required classes from other header files. (included in .cpp file)
 class Player;    //  Player.h
@@ -37,7 +42,7 @@ public:
     //  Constructors/Deconstructor
     /** \brief Constructs a default <code>GameEngine</code> object.
      */
-    GameEngine() = default;
+    GameEngine();
 
     /** \brief Constructs a <code>GameEngine</code> object with a given state configuration and a command processor.
      */
@@ -65,19 +70,84 @@ public:
      */
     void stopRunning();
 
+    /** \brief Enables or disables headless mode.
+     *  \remarks A headless engine never blocks on 'Press Enter' prompts or clears the console, writes its gameplay
+     *           output to a quiet sink (see <code>QuietGameOutput</code>), and stops running once the game loop has
+     *           completed or its commands have run out. Meant for automated, throughput-bound runs.
+     */
+    void setHeadless(bool headless);
+
+    /** \brief Sets the maximum number of turns the game loop plays before ending in a draw. 0 means no limit.
+     */
+    void setMaxTurns(int maxTurns);
+
+    /** \brief Restarts the random number generator of the game from the given seed. A game played from the same seed
+     *         and the same commands makes the same random choices. Engines are randomly seeded by default.
+     */
+    void setSeed(std::uint64_t seed);
+
     //  Getter/Accessor methods
     /** \brief Is the game running
      */
     bool isGameRunning() const;
 
+    /** \brief Is the engine running headless
+     */
+    bool isHeadless() const;
+
     /** \brief Returns the list of players.
+     *  \remarks Non-owning view, invalidated when players are added or removed.
      */
-    std::vector<Player *> getPlayers() const;
+    std::span<Player *const> getPlayers() const { return players; }
 
     /** \brief Returns the currently loaded map.
      */
     Map *getMap() const;
 
+    /** \brief Returns the deck of the game. Every player added to the engine plays with it.
+     */
+    Deck &getDeck();
+
+    /** \brief Returns the seed the random number generator of the game was last started from.
+     */
+    std::uint64_t getSeed() const;
+
+    /** \brief Returns the random number generator of the game. Every player added to the engine draws from it.
+     */
+    Random &getRandom();
+
+    /** \brief Returns the neutral player of the game, who owns the territories blockaded by the players. Every player
+     *         added to the engine blockades to it.
+     */
+    Player *getNeutralPlayer() const;
+
+    /** \brief Returns the truces of the current turn. Every player added to the engine is seated in them, in the order
+     *         they were added; they are all ended at the start of every turn.
+     */
+    NegotiationMatrix &getNegotiations();
+
+    /** \brief Returns the number of turns played by the last game loop.
+     */
+    int getTurnsPlayed() const;
+
+    /** \brief Returns the winner of the last game loop, or nullptr if it ended in a draw or has not been played.
+     */
+    Player *getWinner() const;
+
+    /** \brief What the last orders phase allocated: the Order objects made by the orders lists of the players, and
+     *         the heap allocations made while it ran.
+     *  \remarks Heap allocations are only counted when built with <code>COUNT_ALLOCATIONS</code>, and are 0 otherwise.
+     */
+    struct OrdersPhaseAllocations
+    {
+        size_t ordersBoxed = 0;
+        size_t heapAllocations = 0;
+    };
+
+    /** \brief Returns what the last orders phase allocated.
+     */
+    OrdersPhaseAllocations getLastOrdersPhaseAllocations() const;
+
     //  Setter/Mutator methods
     /** \brief Sets the command processor for the object.
      */
@@ -85,10 +155,12 @@ public:
     /** \brief Gets the command processor for the object.
      */
     CommandProcessor *getCommandProcessor();
-    /** \brief Sets the players. Returns a vector of the previous players.
+    /** \brief Sets the players, who then play with the deck, random number generator and neutral player of the
+     *         engine, and whose orders are watched by the observers of the engine. Returns a vector of the previous
+     *         players.
      */
     std::vector<Player *> setPlayers(std::vector<Player *>);
-    /** \brief Sets the currently loaded map.
+    /** \brief Sets the currently loaded map, which the engine takes ownership of. The previous map is deleted.
      */
     void setMap(Map *);
     /** \brief Gets pointer to Player from given name
@@ -96,7 +168,9 @@ public:
     Player *getPlayerByName(const std::string &name) const;
 
     //  Additional behavior for Setter/Mutators
-    /** \brief Appends a player instance to the end of the player vector. Moves data.
+    /** \brief Appends a player instance to the end of the player vector, who then plays with the deck, random number
+     *         generator and neutral player of the engine, and whose orders are watched by the observers of the engine.
+     *         Moves data.
      */
     void addPlayer(Player *);
     /** \brief Returns the number of currently registered players.
@@ -108,8 +182,13 @@ public:
      */
     string stringToLog() override;
 
+    /**
+     * \brief   Describes the state change for the binary event log
+     */
+    LogEntry toLogEntry() override;
+
     //  Gameplay methods
-    /**  \brief Enters the main gameplay loop.
+    /**  \brief Enters the main gameplay loop. Attached observers are flushed once the game is over.
      */
     void mainGameLoop();
 
@@ -121,11 +200,13 @@ public:
      */
     void issueOrdersPhase();
 
-    /** \brief In the player order determined at game start, executes the orders each player has issued.
+    /** \brief Executes the orders each player has issued: every deploy order first, then the other orders. Within
+     *         each phase, players take turns executing one order, in the player order determined at game start.
      */
     void executeOrdersPhase();
 
-    /** \brief Removes all players who do not have any territories anymore.
+    /** \brief Removes all players who do not have any territories anymore, returning their cards to the deck. The
+     *         engine keeps ownership of them until it is destroyed.
      */
     void removeDefeatedPlayers();
 
@@ -145,12 +226,53 @@ private:
     //  The game engine is responsible for deallocating each state in the list.
     std::vector<Player *> players = {};
 
+    //  Players removed from the game after losing all of their territories.
+    //  The game engine is responsible for deallocating each player in the list.
+    std::vector<Player *> defeatedPlayers = {};
+
     //  The playing map
     Map *map = nullptr;
 
+    //  The deck of the game, owned by the engine so that concurrently running games never share cards.
+    //  Cards in the hands of players are returned to it when the engine is destroyed.
+    Deck deck;
+
+    //  Every random choice of the game is drawn from this generator, so that games can be replayed from their seed
+    std::uint64_t seed = Random::randomSeed();
+    Random random{seed};
+
+    //  Owner of the territories blockaded in the game, kept apart from the players so that it is never eliminated.
+    //  Owned by the engine, so that concurrently running games never share territories.
+    //  The game engine is responsible for deallocating.
+    Player *neutralPlayer = nullptr;
+
+    //  Truces between the players, by seat, for the current turn
+    NegotiationMatrix negotiations;
+    static_assert(MAX_PLAYERS <= NegotiationMatrix::MAX_SEATS);
+
+    //  Heads of the orders lists during the orders phase, in a heap keyed on (phase, round, player). Kept between
+    //  turns, so that scheduling the orders does not allocate once it has grown to the number of players
+    struct ScheduledOrder
+    {
+        int phase;
+        int round;
+        size_t player;
+    };
+    std::vector<ScheduledOrder> orderSchedule;
+    OrdersPhaseAllocations lastOrdersPhase;
+
+    //  Turn limit of the game loop (0 for none), and the outcome of the last game loop
+    int maxTurns = 0;
+    int turnsPlayed = 0;
+    Player *winner = nullptr;
+
     bool isRunning = false;
 
-    //  Checks if a player owns all the territories in a continent
+    //  Headless mode: no blocking prompts, no console clears, quiet gameplay output
+    bool headless = false;
+
+    //  Checks if a player owns all the territories in a continent, in constant time: players count the territories
+    //  they own in each continent
     static bool playerOwnsContinent(Player *player, Continent *continent);
 
     //  Further process a command. Calls the corresponding transition function.
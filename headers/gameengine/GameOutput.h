@@ -0,0 +1,49 @@
+#ifndef GAME_OUTPUT_H
+#define GAME_OUTPUT_H
+
+//  Compiler specific macros
+//  Disables clang modernize suggestions
+#ifdef __GNUC__
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "modernize-use-nodiscard"
+#endif
+
+#include <ostream>
+
+/** \brief Returns the stream that gameplay output (prompts, phase and order messages) is written to on the calling
+ *         thread.
+ *  \remarks This is <code>std::cout</code>, unless output is quiet on the calling thread (see
+ *           <code>QuietGameOutput</code>), in which case a sink discarding everything is returned. Errors are not
+ *           affected and keep going to <code>std::cerr</code>. */
+std::ostream &gameOut();
+
+/** \brief Returns whether gameplay output is currently discarded on the calling thread. Lets callers skip building
+ *         output that would be thrown away. */
+bool isGameOutputQuiet();
+
+/** \class QuietGameOutput
+ *  \brief Silences <code>gameOut()</code> on the calling thread for the lifetime of the object.
+ *  \remarks Scopes nest: the previous setting is restored on destruction. Being thread-local, games running on
+ *           different threads can be silenced independently. */
+class QuietGameOutput
+{
+public:
+    /** \brief Silences gameplay output on the calling thread, if <code>quiet</code> is true. */
+    explicit QuietGameOutput(bool quiet = true);
+
+    /** \brief Restores the previous setting. */
+    ~QuietGameOutput();
+
+    //  Deleted members
+    QuietGameOutput(const QuietGameOutput &) = delete;
+    QuietGameOutput &operator=(const QuietGameOutput &) = delete;
+
+private:
+    bool previous;
+};
+
+#ifdef __GNUC__
+#pragma clang diagnostic pop
+#endif
+
+#endif // GAME_OUTPUT_H
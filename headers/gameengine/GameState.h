@@ -0,0 +1,110 @@
+#ifndef GAME_STATE_H
+#define GAME_STATE_H
+
+//  Compiler specific macros
+//  Disables clang modernize suggestions
+#ifdef __GNUC__
+#pragma clang diagnostic push
+#pragma ide diagnostic ignored "modernize-use-nodiscard"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../Cards.h"
+
+//  Forward declaration of required classes from other header files. (included in .cpp file)
+class GameEngine; //  gameengine/GameEngine.h
+
+/** \class GameState
+ *  \brief A snapshot of a game in flat arrays: the armies and owner of every territory, by territory id, and the
+ *         reinforcement pool, hand and negotiations of every player, by position in the game's list of players.
+ *  \remarks Every value is kept in one contiguous block of 32 bit integers, so that forking a state into another
+ *           state of the same game is a single <code>memcpy</code>: search-based players and what-if analysis can
+ *           explore thousands of states per second without touching the game. The map and the players are not
+ *           copied, only referred to by id: a state can only be applied back to the game it was captured from, while
+ *           it has the same players (in the same order) and the same deck. */
+class GameState
+{
+public:
+    /** \brief Owner of a territory owned by no player. */
+    static constexpr int32_t NO_OWNER = -1;
+
+    /** \brief Owner of a territory owned by the neutral player (see <code>GameEngine::getNeutralPlayer()</code>). */
+    static constexpr int32_t NEUTRAL = -2;
+
+    /** \brief Number of card types a hand is counted by. */
+    static constexpr size_t NUM_CARD_TYPES = 5;
+
+    /** \brief Constructs an empty state, of no territory and no player. */
+    GameState() = default;
+
+    /** \brief Captures the current state of a game. The game must have a map. */
+    explicit GameState(GameEngine &gameEngine);
+
+    /** \brief Copies another state into this one. Once both states are of the same game, copies a single block of
+     *         memory without allocating.
+     */
+    void forkFrom(const GameState &other);
+
+    /** \brief Writes the state back into the game it was captured from: moves the territories that changed owner,
+     *         sets the armies and reinforcement pools, exchanges cards between the hands and the deck, and resets the
+     *         negotiations.
+     *  \return False, printing why, if the game does not match the state: other map, other number of players, or
+     *          cards missing from the deck. The rest of the state is still applied.
+     */
+    bool applyTo(GameEngine &gameEngine) const;
+
+    size_t getNumTerritories() const { return numTerritories; }
+    size_t getNumPlayers() const { return numPlayers; }
+
+    int32_t getArmies(size_t territory) const { return values[territory]; }
+    void setArmies(size_t territory, int32_t armies) { values[territory] = armies; }
+
+    /** \brief Returns the position of the owner of a territory in the game's list of players, or one of
+     *         <code>NO_OWNER</code> and <code>NEUTRAL</code>.
+     */
+    int32_t getOwner(size_t territory) const { return values[ownersOffset() + territory]; }
+    void setOwner(size_t territory, int32_t player) { values[ownersOffset() + territory] = player; }
+
+    int32_t getReinforcementPool(size_t player) const { return values[poolsOffset() + player]; }
+    void setReinforcementPool(size_t player, int32_t units) { values[poolsOffset() + player] = units; }
+
+    int32_t getCardCount(size_t player, type cardType) const { return values[cardOffset(player, cardType)]; }
+    void setCardCount(size_t player, type cardType, int32_t count) { values[cardOffset(player, cardType)] = count; }
+
+    /** \brief Returns whether two players are in negotiation. */
+    bool inNegotiation(size_t player, size_t otherPlayer) const
+    {
+        return (values[negotiationsOffset() + player] >> otherPlayer) & 1;
+    }
+
+    /** \brief Puts two players in negotiation, or ends their negotiation. Negotiations are mutual. */
+    void setNegotiation(size_t player, size_t otherPlayer, bool negotiating);
+
+    /** \brief Returns whether two states hold the same values. */
+    bool operator==(const GameState &other) const = default;
+
+private:
+    size_t numTerritories = 0;
+    size_t numPlayers = 0;
+
+    //  Armies and owners of the territories, pools, hands (card counts by type) and negotiations of the players, one
+    //  after the other. The negotiations of a player are a bit mask of the players they are in negotiation with
+    std::vector<int32_t> values;
+
+    size_t ownersOffset() const { return numTerritories; }
+    size_t poolsOffset() const { return 2 * numTerritories; }
+    size_t cardOffset(size_t player, type cardType) const
+    {
+        return poolsOffset() + numPlayers + player * NUM_CARD_TYPES + static_cast<size_t>(cardType);
+    }
+    size_t negotiationsOffset() const { return poolsOffset() + numPlayers * (1 + NUM_CARD_TYPES); }
+};
+
+#ifdef __GNUC__
+#pragma clang diagnostic pop
+#endif
+
+#endif // GAME_STATE_H
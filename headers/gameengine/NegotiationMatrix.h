@@ -0,0 +1,39 @@
+#ifndef NEGOTIATION_MATRIX_H
+#define NEGOTIATION_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+
+/** \class NegotiationMatrix
+ *  \brief The truces of the current turn between the players of a game, by seat: a symmetric matrix of bits, bit
+ *         (i, j) set when the players in seats i and j are negotiating.
+ *  \remarks The whole matrix is a single 64 bit word, eight rows of eight bits: checking a truce, making one and ending
+ *           every truce at the start of a turn are each a single operation on it. */
+class NegotiationMatrix
+{
+public:
+    /** \brief Number of seats, and so of players, the matrix holds. */
+    static constexpr size_t MAX_SEATS = 8;
+
+    /** \brief Returns whether the players in two seats are negotiating. */
+    bool inNegotiation(size_t seat, size_t otherSeat) const noexcept { return (bits & bit(seat, otherSeat)) != 0; }
+
+    /** \brief Makes a truce between the players in two seats, for the rest of the turn. */
+    void negotiate(size_t seat, size_t otherSeat) noexcept { bits |= bit(seat, otherSeat) | bit(otherSeat, seat); }
+
+    /** \brief Ends every truce. */
+    void clear() noexcept { bits = 0; }
+
+    /** \brief Returns whether any players are negotiating. */
+    bool empty() const noexcept { return bits == 0; }
+
+private:
+    uint64_t bits = 0;
+
+    static uint64_t bit(size_t seat, size_t otherSeat) noexcept
+    {
+        return uint64_t{1} << (seat * MAX_SEATS + otherSeat);
+    }
+};
+
+#endif // NEGOTIATION_MATRIX_H
@@ -8,18 +8,27 @@
 #pragma ide diagnostic ignored "modernize-use-nodiscard"
 #endif
 
+#include <cstdint>
 #include <iostream>
 #include <vector>
+#include <span>
 #include <string>
 #include <memory>
 
 #include "PlayerStrategies.h"
 #include "../Orders.h"
+#include "../DynamicBitset.h"
+#include "../Cards.h"
 
 //  Forward declaration of required classes from other header files. (included in .cpp file)
 class OrdersList; //  Orders.h
 class Card;       //  Cards.h
+class Deck;       //  Cards.h
 class Territory;  //  Map.h
+class Continent;  //  Map.h
+class Map;        //  Map.h
+class Random;     //  Random.h
+class NegotiationMatrix; //  gameengine/NegotiationMatrix.h
 
 using namespace std;
 
@@ -29,6 +38,19 @@ using namespace std;
 class Player final
 {
 private:
+    //  Territories listed once each, in no particular order, with their ids and their positions by id: a territory is
+    //  added and removed in constant time, the last territory of the list taking the place of a removed one
+    struct TerritorySet
+    {
+        vector<Territory *> territories;
+        vector<size_t> ids;
+        vector<size_t> positions;
+
+        bool contains(size_t id) const;
+        void add(Territory &territory);
+        void remove(size_t id);
+    };
+
     //  Name of the player
     string name;
 
@@ -49,24 +71,53 @@ private:
     //  Class has single/sole ownership
     OrdersList *ordersList;
 
-    //  The list of territories the player currently owns
+    //  The list of territories the player currently owns, in no particular order: a territory that is lost is replaced
+    //  by the last one of the list
     //  Class has NO ownership of the objects in the vector
     vector<Territory *> territories;
 
+    //  Map ids of the territories in 'territories', at the same positions
+    vector<size_t> territoryIds;
+
+    //  Ids of the owned territories, and for each of them the position in 'territories' of the territory with that id.
+    //  Ids are unique within a map, and a player only owns territories of the map of their game
+    DynamicBitset ownedTerritoryIds;
+    vector<size_t> territoryPositions;
+
+    //  Number of owned territories in each continent, by continent id
+    vector<size_t> continentTerritories;
+
+    //  Frontier of the player: the number of owned territories adjacent to each territory, by territory id, the owned
+    //  territories adjacent to a territory they do not own, and the territories they do not own adjacent to an owned
+    //  one. Kept up to date in time proportional to the number of neighbours of a territory added or removed, so
+    //  territories must be linked to their neighbours before they are owned. Like the index above, it goes by id
+    vector<uint32_t> ownedNeighbours;
+    TerritorySet borderTerritories;
+    TerritorySet enemyNeighbours;
+
     //  The list of cards that the player has drawn
     //  Class has NO ownership of the objects in the vector
     vector<Card *> cards;
 
-    //  The list of 'Player' objects the player is currently in negotiation with
-    //  Class has NO ownership of the objects in the vector
-    vector<Player *> playersInNegotiation;
+    //  The deck of the game the player takes part in, played cards go back to it. nullptr outside of a game
+    //  Class has NO ownership of the object
+    Deck *deck = nullptr;
 
-public:
-    /** \brief A 'player' object that represents neutrality. Un-claimed and un-owned territories not belonging to any
-     *         player in the game is owned by this placeholder 'player'.
-     */
-    static Player *neutralPlayer;
+    //  The random number generator of the game the player takes part in. nullptr outside of a game
+    //  Class has NO ownership of the object
+    Random *random = nullptr;
+
+    //  The neutral player of the game the player takes part in, who takes the territories they blockade. nullptr
+    //  outside of a game
+    //  Class has NO ownership of the object
+    Player *neutralPlayer = nullptr;
 
+    //  The truces of the game the player takes part in, and the player's seat in them. nullptr outside of a game
+    //  Class has NO ownership of the object
+    NegotiationMatrix *negotiations = nullptr;
+    size_t seat = 0;
+
+public:
     /** \brief Initializes a default <code>Player</code> object.
      */
     Player();
@@ -163,7 +214,7 @@ public:
      */
     PlayerStrategy *getPlayerStrategy() const;
 
-    /** \brief Sets the PlayerStrategy.
+    /** \brief Sets the PlayerStrategy, deleting the previous one. The player takes ownership of the new strategy.
      */
     void setPlayerStrategy(PlayerStrategy *playerStrategy);
 
@@ -175,19 +226,29 @@ public:
     /** \brief Returns whether or not the player is to draw a card at the end of their turn. */
     bool drawsCard() const;
 
-    /** \brief Returns a vector of territories that is associated to the player.
+    /** \brief Returns the territories that are associated to the player.
+     *  \remarks Non-owning view, invalidated when the player gains or loses a territory: copy it to conquer
+     *           territories while iterating.
      */
-    vector<Territory *> getTerritories();
+    std::span<Territory *const> getTerritories() const { return territories; }
 
     /** \brief Returns a list of cards that the player has drawn.
      *  \remarks The vector has cards that cannot be changed. Meant primarily for readonly operations.
      */
     vector<const Card *> getCards() const;
 
-    /** \brief Returns a list of the players that are currently in negotiation with the player
-     *  \remarks The vector has players that cannot be changed. Meant primarily for readonly operations.
+    /** \brief Returns the deck that cards played by the player go back to, or nullptr if none was set. */
+    Deck *getDeck() const;
+
+    /** \brief Returns the random number generator that the player's strategy and orders draw from: the one of their
+     *         game, or the generator of the calling thread outside of a game.
+     */
+    Random &getRandom() const;
+
+    /** \brief Returns the neutral player of the player's game, who owns the territories they blockade, or nullptr
+     *         outside of a game.
      */
-    vector<const Player *> getPlayersInNegotiation() const;
+    Player *getNeutralPlayer() const { return neutralPlayer; }
 
     /** \brief Gets the <code>OrdersList</code> object of the class. */
     OrdersList *getOrdersList() const;
@@ -212,28 +273,103 @@ public:
     /** \brief Sets whether or not the player should draw a card at the end of their turn. */
     void setDrawCard(bool drawCard);
 
-    /** \brief Adds a <code>Territory</code> object to the list of owned territories. */
+    /** \brief Sets the deck that cards played by the player go back to. Set by the game engine the player is added to.
+     *  \remarks Without a deck, played cards simply leave the player's hand.
+     */
+    void setDeck(Deck *deck);
+
+    /** \brief Sets the random number generator of the player's game. Set by the game engine the player is added to.
+     */
+    void setRandom(Random *random);
+
+    /** \brief Sets the neutral player of the player's game. Set by the game engine the player is added to.
+     */
+    void setNeutralPlayer(Player *neutral) { neutralPlayer = neutral; }
+
+    /** \brief Seats the player at the truces of their game. Set by the game engine the player is added to.
+     *  \param negotiations The truces of the game, nullptr to take the player out of them.
+     *  \param seat         The player's seat, below <code>NegotiationMatrix::MAX_SEATS</code>.
+     */
+    void setNegotiations(NegotiationMatrix *negotiations, size_t seat);
+
+    /** \brief Adds a <code>Territory</code> object to the list of owned territories, in constant time. Adding a
+     *         territory the player already owns does nothing.
+     */
     void addTerritory(Territory &newTerritory);
 
     /** \brief Adds a <code>Card</code> object to the list of cards. */
     void addCard(Card &newCard);
 
-    /** \brief Adds a player to the list of players currently under negotiation. */
+    /** \brief Takes a card of the given type out of the player's hand.
+     *  \return The card, now owned by the caller, or nullptr if the player has no card of the type.
+     */
+    Card *removeCard(type cardType);
+
+    /** \brief Puts every card in the player's hand back into the given deck, emptying the hand. */
+    void returnCards(Deck &deck);
+
+    /** \brief Makes a truce with another player of the same game, until the end of the turn. Prints an error if the
+     *         players cannot negotiate (see <code>canNegotiateWith(...)</code>).
+     */
     void negotiateWith(Player &player);
 
-    /** \brief Removes a territory from the player's owned territory list. */
+    /** \brief Checks whether the player can negotiate with another player: both are seated in the same game, in
+     *         different seats.
+     */
+    bool canNegotiateWith(const Player &player) const;
+
+    /** \brief Sizes the lists and indexes of the owned territories for every territory and continent of a map, so
+     *         that owning and losing its territories never allocates. Called once the map of the game is known.
+     */
+    void reserveTerritories(const Map &map);
+
+    /** \brief Removes a territory from the player's owned territory list, in constant time. The last territory of
+     *         the list takes its place.
+     */
     void removeTerritory(Territory &target);
 
-    /** \brief Checks whether a player owns a specified territory. */
+    /** \brief Checks whether a player owns a specified territory, in constant time. */
     bool ownsTerritory(Territory &territory) const;
 
-    /** \brief Checks whether a specified territory is adjacent to any of the player's owned territories.
-     *  \remarks <ul><li>In the case that the player owns the target territory, returns true.</ul>
+    /** \brief Returns the number of territories of a continent the player owns, in constant time. */
+    size_t territoriesOwnedIn(const Continent &continent) const;
+
+    /** \brief Checks whether the player owns every territory of a continent, in constant time. */
+    bool ownsContinent(const Continent &continent) const;
+
+    /** \brief Checks whether a specified territory is adjacent to any of the player's owned territories, in constant
+     *         time.
+     *  \remarks Borders are taken to be mutual, as map files list them both ways.
      */
     bool isTerritoryAdjacent(Territory &target) const;
 
-    /** \brief Checks whether another player is currently under negotiations. */
-    bool isPlayerInNegotiations(Player &player) const;
+    /** \brief Returns the owned territories adjacent to a territory the player does not own, each once, in no
+     *         particular order.
+     */
+    inline std::span<Territory *const> getBorderTerritories() const { return borderTerritories.territories; }
+
+    /** \brief Returns the territories the player does not own adjacent to an owned territory, each once, in no
+     *         particular order: the territories the player can attack, negotiations aside.
+     */
+    inline std::span<Territory *const> getEnemyNeighbours() const { return enemyNeighbours.territories; }
+
+    /** \brief Checks whether a territory the player does not own is adjacent to an owned territory, in constant time.
+     */
+    bool isEnemyNeighbour(const Territory &territory) const;
+
+    /** \brief Checks whether another player is negotiating with the player this turn, in constant time. */
+    bool isPlayerInNegotiations(const Player &player) const;
+
+private:
+    //  Removes the territory at the given position of 'territories', moving the last territory in its place
+    void removeTerritoryAt(size_t position);
+
+    //  Counts a territory added to ('change' 1) or removed from ('change' -1) the owned territories among the owned
+    //  neighbours of its neighbours, then moves it and its neighbours in or out of the frontier
+    void updateFrontier(Territory &territory, int change);
+
+    //  Lists a territory in the frontier, or takes it out, according to its owner and its owned neighbours
+    void classifyFrontier(Territory &territory);
 };
 
 #ifdef __GNUC__
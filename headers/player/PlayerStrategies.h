@@ -1,6 +1,8 @@
 #ifndef PLAYER_STRATEGIES_H
 #define PLAYER_STRATEGIES_H
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <vector>
 using namespace std;
@@ -10,6 +12,7 @@ class Territory;
 class Order;
 class Player;
 class GameEngine;
+class ThreadPool;
 
 /** \brief  An interface for classes to customize/adapt the attack and defending patterns or behaviors of a player.
  *          This class is intended to be coupled with a corresponding <code>Player</code> object and it determines the
@@ -43,12 +46,25 @@ public:
 
     virtual std::vector<Territory *> toDefend() = 0;
 
-    virtual PlayerStrategy *clone() = 0;
+    /** \brief Returns a new strategy of the same behavior, for another player. The caller owns it.
+     *  \param owner The player the copy is for.
+     */
+    virtual PlayerStrategy *clone(Player *owner) const = 0;
 
 protected:
     /** \brief The player associated with this <code>PlayerStrategy</code> object.
      */
     Player *player;
+
+    /** \brief Returns the probability of conquering a territory by advancing the given number of units onto it. A
+     *         table lookup, see <code>CombatOdds</code>.
+     */
+    static double conquestProbability(int armyUnits, const Territory &target);
+
+    /** \brief Returns the number of units expected to occupy a territory once conquered with the given number of units.
+     *         A table lookup, see <code>CombatOdds</code>.
+     */
+    static double expectedSurvivors(int armyUnits, const Territory &target);
 };
 
 class HumanPlayerStrategy final : public PlayerStrategy
@@ -61,7 +77,7 @@ public:
     void issueOrders(GameEngine *) override;
     std::vector<Territory *> toAttack() override;
     std::vector<Territory *> toDefend() override;
-    PlayerStrategy *clone() override;
+    PlayerStrategy *clone(Player *owner) const override;
 };
 
 class AggressivePlayerStrategy final : public PlayerStrategy
@@ -74,7 +90,7 @@ public:
     void issueOrders(GameEngine *) override;
     std::vector<Territory *> toAttack() override;
     std::vector<Territory *> toDefend() override;
-    PlayerStrategy *clone() override;
+    PlayerStrategy *clone(Player *owner) const override;
 };
 
 class BenevolentPlayerStrategy final : public PlayerStrategy
@@ -87,7 +103,7 @@ public:
     void issueOrders(GameEngine *) override;
     std::vector<Territory *> toAttack() override;
     std::vector<Territory *> toDefend() override;
-    PlayerStrategy *clone() override;
+    PlayerStrategy *clone(Player *owner) const override;
 };
 
 class NeutralPlayerStrategy final : public PlayerStrategy
@@ -100,7 +116,7 @@ public:
     void issueOrders(GameEngine *) override;
     std::vector<Territory *> toAttack() override;
     std::vector<Territory *> toDefend() override;
-    PlayerStrategy *clone() override;
+    PlayerStrategy *clone(Player *owner) const override;
 };
 
 class CheaterPlayerStrategy final : public PlayerStrategy
@@ -113,7 +129,68 @@ public:
     void issueOrders(GameEngine *) override;
     std::vector<Territory *> toAttack() override;
     std::vector<Territory *> toDefend() override;
-    PlayerStrategy *clone() override;
+    PlayerStrategy *clone(Player *owner) const override;
+};
+
+/** \brief  Plans its orders by Monte Carlo tree search: plays the game on from the current position many times, on flat
+ *          copies of the game (see <code>GameState</code>), and issues the orders that fared best.
+ *  \remarks    <ul><li>Every turn, the player deploys its whole reinforcement pool on one territory, then may attack a
+ *                      neighbour of it with all but one unit, bombing it first if it holds a bomb card. Each of these
+ *                      plans is a child of the root of the search, picked by UCB1; a playout applies it, then plays
+ *                      every player with a fast random policy for a few turns, and scores the share of the map the
+ *                      player ends up with.
+ *                  <li>Each search thread searches on its own (root parallelism) for its share of the playouts of the
+ *                      turn, from a seed drawn from the game, and the statistics of the threads are summed to pick the
+ *                      plan played most often. Threads other than the calling one belong to the player, so searches
+ *                      never wait behind those of other games.
+ *                  <li>By default, the search is bounded by a number of playouts: games with this player are replayed
+ *                      from their seed, as long as the number of threads is the same. A time budget can be set on
+ *                      top of it, or instead, at the cost of reproducibility.
+ *              </ul>
+ */
+class MctsPlayerStrategy final : public PlayerStrategy
+{
+public:
+    /** \brief Statistics of the search of a turn. */
+    struct SearchStatistics
+    {
+        size_t rollouts = 0;    //  Playouts, summed over the threads
+        unsigned threads = 0;   //  Threads searching
+        double seconds = 0;     //  Time the search took
+    };
+
+    /** \brief Playouts the player searches for each turn, by default. */
+    static constexpr size_t DEFAULT_ROLLOUTS = 2000;
+
+    /** \brief Initializes the strategy.
+     *  \param owner        The player the strategy plays for.
+     *  \param maxRollouts  Playouts searched for each turn, 0 for as many as the time budget allows.
+     *  \param numThreads   Threads searching. 0 for the number of hardware threads, which makes the games depend on
+     *                      the machine.
+     *  \param timeBudget   If not 0, the search also stops once this time has passed. Games then depend on the speed
+     *                      of the machine.
+     */
+    explicit MctsPlayerStrategy(Player *owner, size_t maxRollouts = DEFAULT_ROLLOUTS, unsigned numThreads = 1,
+                                std::chrono::milliseconds timeBudget = std::chrono::milliseconds::zero());
+    ~MctsPlayerStrategy() override;
+
+    void play() override;
+    void issueOrders(GameEngine *) override;
+    std::vector<Territory *> toAttack() override;
+    std::vector<Territory *> toDefend() override;
+    PlayerStrategy *clone(Player *owner) const override;
+
+    /** \brief Returns the statistics of the last search, made by the last call to <code>issueOrders(...)</code>. */
+    SearchStatistics getLastSearch() const { return lastSearch; }
+
+private:
+    size_t maxRollouts;
+    unsigned numThreads;
+    std::chrono::milliseconds timeBudget;
+    SearchStatistics lastSearch;
+
+    //  Threads searching along with the calling one, started at the first search that needs them
+    std::unique_ptr<ThreadPool> searchPool;
 };
 
 #endif //  PLAYER_STRATEGIES_H
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include <cstdlib>
+#include <new>
+
+#include "../headers/AllocationCounter.h"
+
+//  Only built in when asked for (CMake option COUNT_ALLOCATIONS): every allocation of the game would pay for counting
+#ifdef COUNT_ALLOCATIONS
+
+//  Allocations of the thread. Trivially constructed, so that it can be counted before anything else is initialized
+static thread_local size_t threadAllocations = 0;
+
+size_t AllocationCounter::allocations()
+{
+    return threadAllocations;
+}
+
+void *operator new(size_t size)
+{
+    threadAllocations++;
+    //  malloc(0) may return nullptr, which operator new may not
+    while (true)
+    {
+        if (void *block = std::malloc(size == 0 ? 1 : size))
+            return block;
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void operator delete(void *block) noexcept
+{
+    std::free(block);
+}
+
+void operator delete(void *block, size_t) noexcept
+{
+    std::free(block);
+}
+
+#endif // COUNT_ALLOCATIONS
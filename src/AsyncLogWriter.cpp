@@ -0,0 +1,162 @@
+#include <iostream>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+
+#include "../headers/AsyncLogWriter.h"
+
+//  Size of the text gathered by the writer thread before it is appended to the file
+static constexpr size_t BATCH_BYTES = 64 * 1024;
+
+//  Longest time a line waits in the queue before the writer thread appends it
+static constexpr std::chrono::milliseconds DRAIN_INTERVAL(20);
+
+AsyncLogWriter::AsyncLogWriter(const std::string &filePath, size_t capacity)
+    : file(filePath, std::ios::out | std::ios::trunc | std::ios::binary)
+{
+    capacity = std::bit_ceil(std::max<size_t>(capacity, 2));
+    slots = std::make_unique<Slot[]>(capacity);
+    mask = capacity - 1;
+    for (size_t i = 0; i < capacity; i++)
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+
+    if (!file.is_open())
+    {
+        std::cerr << "ERROR: Unable to open the log file \"" << filePath << "\"." << std::endl;
+        return;
+    }
+    writerThread = std::thread(&AsyncLogWriter::run, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter()
+{
+    if (!writerThread.joinable())
+        return;
+
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_one();
+    writerThread.join();
+}
+
+bool AsyncLogWriter::isOpen() const
+{
+    return writerThread.joinable();
+}
+
+void AsyncLogWriter::write(std::string line)
+{
+    if (!isOpen())
+        return;
+
+    size_t position = enqueuePosition.load(std::memory_order_relaxed);
+    Slot *slot;
+    while (true)
+    {
+        slot = &slots[position & mask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+        if (difference == 0)
+        {
+            //  The cell is free: claim it
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+        {
+            //  The queue is full: let the writer thread catch up
+            wakeWriter();
+            std::this_thread::yield();
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            //  Another producer claimed the cell first
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->line = std::move(line);
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    //  Every half queue, the writer thread is woken up rather than left to its periodic drain
+    if ((position & (mask >> 1)) == 0)
+        wakeWriter();
+}
+
+void AsyncLogWriter::flush()
+{
+    if (!isOpen())
+        return;
+
+    size_t target = enqueuePosition.load();
+    size_t written = linesWritten.load();
+    while (written < target)
+    {
+        wakeWriter();
+        linesWritten.wait(written);
+        written = linesWritten.load();
+    }
+}
+
+bool AsyncLogWriter::pop(std::string &line)
+{
+    Slot &slot = slots[dequeuePosition & mask];
+    if (slot.sequence.load(std::memory_order_acquire) != dequeuePosition + 1)
+        return false;
+
+    line = std::move(slot.line);
+    slot.line.clear();
+    slot.sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+    dequeuePosition++;
+    return true;
+}
+
+void AsyncLogWriter::wakeWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+void AsyncLogWriter::run()
+{
+    std::string batch;
+    std::string line;
+    batch.reserve(BATCH_BYTES + 1024);
+
+    while (true)
+    {
+        //  Gather lines until the queue is empty or the batch is full, then append them at once
+        size_t lines = 0;
+        while (batch.size() < BATCH_BYTES && pop(line))
+        {
+            batch += line;
+            batch += '\n';
+            lines++;
+        }
+        if (lines > 0)
+        {
+            file.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+            file.flush();
+            batch.clear();
+            linesWritten.fetch_add(lines);
+            linesWritten.notify_all();
+            continue;
+        }
+
+        //  The queue is empty: sleep until the next drain, unless woken up earlier
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        if (stopping)
+            break;
+        wakeCondition.wait_for(lock, DRAIN_INTERVAL, [this]
+                               { return wakeRequested || stopping; });
+        wakeRequested = false;
+    }
+}
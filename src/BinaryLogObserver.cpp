@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "../headers/BinaryLogObserver.h"
+#include "../headers/player/Player.h"
+#include "../headers/Map.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+//  Number of blocks the log file starts with (2 MB), doubled whenever it fills up
+static constexpr size_t INITIAL_CAPACITY = 64 * 1024;
+
+BinaryLogObserver::BinaryLogObserver(const std::string &filePath) : filePath(filePath)
+{
+#ifndef _WIN32
+    fileDescriptor = ::open(filePath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fileDescriptor < 0)
+    {
+        std::cerr << "ERROR: Unable to create the event log \"" << filePath << "\"." << std::endl;
+        return;
+    }
+#endif
+
+    if (!grow(INITIAL_CAPACITY))
+    {
+        std::cerr << "ERROR: Unable to map the event log \"" << filePath << "\"." << std::endl;
+        close();
+        return;
+    }
+
+    std::memcpy(header->magic, EVENT_LOG_MAGIC, sizeof(EVENT_LOG_MAGIC));
+    header->version = EVENT_LOG_VERSION;
+    header->byteOrder = EVENT_LOG_BYTE_ORDER;
+    header->numRecords = 0;
+    header->reserved = 0;
+}
+
+BinaryLogObserver::~BinaryLogObserver()
+{
+    close();
+}
+
+void BinaryLogObserver::Update(ILoggable *log)
+{
+    if (!isOpen())
+        return;
+
+    LogEntry entry = log->toLogEntry();
+    EventRecord record{};
+    record.kind = entry.kind;
+    record.orderType = static_cast<std::uint8_t>(entry.orderType);
+    record.armies = entry.armies;
+    record.value = entry.value;
+
+    switch (entry.kind)
+    {
+    case LogEventKind::TurnStarted:
+        //  Turn 1 starts a new game: its players and territories may reuse the addresses of the previous game's
+        turn = static_cast<std::uint32_t>(entry.value);
+        if (entry.value == 1)
+        {
+            playerIds.clear();
+            territoryIds.clear();
+        }
+        record.turn = turn;
+        append(record);
+        return;
+
+    case LogEventKind::StateChanged:
+        record.turn = turn;
+        append(record, entry.text);
+        return;
+
+    case LogEventKind::OrderIssued:
+    case LogEventKind::OrderExecuted:
+        //  Naming appends records, so ids are resolved before the event is written
+        record.player = idOf(entry.player);
+        record.otherPlayer = idOf(entry.otherPlayer);
+        record.target = idOf(entry.target);
+        record.source = idOf(entry.source);
+        record.turn = turn;
+        append(record);
+        return;
+
+    default:
+        //  Events without a structured description are logged as text
+        record.kind = LogEventKind::Text;
+        record.turn = turn;
+        append(record, log->stringToLog());
+        return;
+    }
+}
+
+void BinaryLogObserver::Flush()
+{
+    if (!isOpen())
+        return;
+
+    header->numRecords = used;
+#ifdef _WIN32
+    //  Without a mapping, the log is kept in memory and written out whole
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(header),
+               static_cast<std::streamsize>(sizeof(EventLogHeader) + used * sizeof(EventRecord)));
+#endif
+}
+
+std::uint32_t BinaryLogObserver::idOf(const Player *player)
+{
+    if (player == nullptr)
+        return EVENT_LOG_NO_ID;
+
+    auto [it, inserted] = playerIds.try_emplace(player, static_cast<std::uint32_t>(playerIds.size()));
+    if (inserted)
+    {
+        EventRecord record{};
+        record.kind = LogEventKind::PlayerName;
+        record.turn = turn;
+        record.value = static_cast<std::int32_t>(it->second);
+        append(record, player->getName());
+    }
+    return it->second;
+}
+
+std::uint32_t BinaryLogObserver::idOf(const Territory *territory)
+{
+    if (territory == nullptr)
+        return EVENT_LOG_NO_ID;
+
+    auto [it, inserted] = territoryIds.try_emplace(territory, static_cast<std::uint32_t>(territoryIds.size()));
+    if (inserted)
+    {
+        EventRecord record{};
+        record.kind = LogEventKind::TerritoryName;
+        record.turn = turn;
+        record.value = static_cast<std::int32_t>(it->second);
+        append(record, territory->getName());
+    }
+    return it->second;
+}
+
+void BinaryLogObserver::append(const EventRecord &record, std::string_view text)
+{
+    text = text.substr(0, std::min<size_t>(text.size(), UINT16_MAX));
+    size_t textBlocks = (text.size() + sizeof(EventRecord) - 1) / sizeof(EventRecord);
+
+    if (used + 1 + textBlocks > capacity && !grow(used + 1 + textBlocks))
+    {
+        std::cerr << "ERROR: Unable to grow the event log \"" << filePath << "\", event dropped." << std::endl;
+        return;
+    }
+
+    EventRecord *destination = blocks + used;
+    std::memcpy(destination, &record, sizeof(EventRecord));
+    destination->textLength = static_cast<std::uint16_t>(text.size());
+    //  The blocks are zeroed by the file (or allocation) growing: the last one stays padded with zeros
+    std::memcpy(destination + 1, text.data(), text.size());
+    used += 1 + textBlocks;
+}
+
+bool BinaryLogObserver::grow(size_t minimumCapacity)
+{
+    size_t newCapacity = std::max(minimumCapacity, capacity * 2);
+    size_t oldBytes = sizeof(EventLogHeader) + capacity * sizeof(EventRecord);
+    size_t newBytes = sizeof(EventLogHeader) + newCapacity * sizeof(EventRecord);
+
+#ifdef _WIN32
+    void *memory = std::realloc(header, newBytes);
+    if (memory == nullptr)
+        return false;
+    std::memset(static_cast<char *>(memory) + (header == nullptr ? 0 : oldBytes), 0,
+                newBytes - (header == nullptr ? 0 : oldBytes));
+#else
+    if (::ftruncate(fileDescriptor, static_cast<off_t>(newBytes)) != 0)
+        return false;
+    if (header != nullptr)
+        ::munmap(header, oldBytes);
+    void *memory = ::mmap(nullptr, newBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    if (memory == MAP_FAILED)
+    {
+        header = nullptr;
+        blocks = nullptr;
+        return false;
+    }
+#endif
+
+    header = static_cast<EventLogHeader *>(memory);
+    blocks = reinterpret_cast<EventRecord *>(header + 1);
+    capacity = newCapacity;
+    return true;
+}
+
+void BinaryLogObserver::close()
+{
+    Flush();
+
+#ifdef _WIN32
+    std::free(header);
+#else
+    if (header != nullptr)
+        ::munmap(header, sizeof(EventLogHeader) + capacity * sizeof(EventRecord));
+    if (fileDescriptor >= 0)
+    {
+        //  Trims the unused blocks off the end of the file
+        if (header != nullptr && ::ftruncate(fileDescriptor, static_cast<off_t>(sizeof(EventLogHeader) +
+                                                                                 used * sizeof(EventRecord))) != 0)
+            std::cerr << "ERROR: Unable to trim the event log \"" << filePath << "\"." << std::endl;
+        ::close(fileDescriptor);
+    }
+#endif
+
+    header = nullptr;
+    blocks = nullptr;
+    fileDescriptor = -1;
+}
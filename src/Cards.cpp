@@ -1,10 +1,11 @@
+#include <algorithm>
 #include <iostream>
 #include <vector>
-#include <random>
 
 #include "../headers/Cards.h"
 #include "../headers/player/Player.h"
 #include "../headers/Map.h"
+#include "../headers/Random.h"
 
 
 using namespace std;
@@ -102,12 +103,6 @@ std::ostream &operator<<(std::ostream &os, const Deck &deck)
     return os;
 }
 
-Deck &Deck::getInstance()
-{
-    static Deck instance;
-    return instance;
-}
-
 Deck::Deck()
 {
     for (size_t i = 0; i < 3; i++)
@@ -120,14 +115,15 @@ Deck::Deck()
     }
 }
 
-Card *Deck::draw()
+Card *Deck::draw(Random &random)
 {
-    std::random_device r;
-    std::mt19937 rng(r());
-    // The number generated will be between 0 and the length of the deck size.
-    std::uniform_int_distribution<int> uniform_dist(0, cardList.size() - 1);
+    if (cardList.empty())
+    {
+        return nullptr;
+    }
 
-    int randNum = uniform_dist(rng);
+    // The number generated will be between 0 and the length of the deck size.
+    size_t randNum = random.nextIndex(cardList.size());
 
     // The card that got randomly chosen
     Card *cardSelected = cardList[randNum];
@@ -140,6 +136,20 @@ Card *Deck::draw()
     return cardSelected;
 }
 
+Card *Deck::take(type cardType)
+{
+    auto it = std::find_if(cardList.begin(), cardList.end(), [cardType](const Card *card)
+                           { return card->getCardType() == cardType; });
+    if (it == cardList.end())
+    {
+        return nullptr;
+    }
+
+    Card *card = *it;
+    cardList.erase(it);
+    return card;
+}
+
 void Deck::addCard(Card *card)
 {
     cardList.push_back(card);
@@ -152,10 +162,8 @@ int Deck::getDeckSize() const
 
 Deck::~Deck()
 {
-    /*
     for (Card *card : cardList)
     {
         delete card;
     }
-     */
 }
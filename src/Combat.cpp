@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "../headers/Combat.h"
+#include "../headers/Random.h"
+
+//  Largest army rolled unit by unit: below it, a roll per unit is cheaper than setting up a sampler
+static constexpr int PER_UNIT_MAX_UNITS = 128;
+
+//  Largest mean number of kills sampled by inversion, which walks the distribution one outcome at a time
+static constexpr double INVERSION_MAX_MEAN = 10.0;
+
+/** \brief Samples a binomial distribution by inversion (BINV, Kachitvichyanukul & Schmeiser). The expected number of
+ *         iterations is about the mean, so <code>probability</code> is at most 0.5 and the mean is small. */
+static int sampleByInversion(int units, double probability, Random &random)
+{
+    const double q = 1.0 - probability;
+    const double s = probability / q;
+    const double a = (units + 1) * s;
+    const double noKills = std::pow(q, units);
+
+    while (true)
+    {
+        double u = random.nextDouble();
+        double r = noKills;
+        int kills = 0;
+        while (u > r && kills <= units)
+        {
+            u -= r;
+            kills++;
+            r *= a / kills - s;
+        }
+
+        //  Rounding can leave u above the total probability, the draw is then discarded
+        if (kills <= units)
+            return kills;
+    }
+}
+
+int sampleKills(int units, double probability, Random &random)
+{
+    if (units <= 0 || probability <= 0.0)
+        return 0;
+    if (probability >= 1.0)
+        return units;
+    if (units <= PER_UNIT_MAX_UNITS)
+        return sampleKillsPerUnit(units, probability, random);
+
+    //  Kills and survivals are symmetric: the less likely of the two is sampled, so that inversion stays short
+    const bool sampleMisses = probability > 0.5;
+    const double p = sampleMisses ? 1.0 - probability : probability;
+
+    int sampled;
+    if (units * p <= INVERSION_MAX_MEAN)
+        sampled = sampleByInversion(units, p, random);
+    else
+        sampled = std::binomial_distribution<int>(units, p)(random);
+
+    return sampleMisses ? units - sampled : sampled;
+}
+
+int sampleKillsPerUnit(int units, double probability, Random &random)
+{
+    int kills = 0;
+    for (int i = 0; i < units; i++)
+    {
+        if (random.nextChance(probability))
+            kills++;
+    }
+    return kills;
+}
+
+namespace
+{
+    //  Exact odds of the battles of up to 'units' units a side, by number of attackers then defenders
+    class OddsTable
+    {
+    public:
+        double conquestProbability(int attackers, int defenders)
+        {
+            reserve(std::max(attackers, defenders));
+            return conquestProbabilities[attackers * stride() + defenders];
+        }
+
+        double expectedSurvivors(int attackers, int defenders)
+        {
+            reserve(std::max(attackers, defenders));
+            return survivors[attackers * stride() + defenders];
+        }
+
+    private:
+        size_t units = 0;
+        std::vector<double> conquestProbabilities;
+        std::vector<double> survivors;
+
+        size_t stride() const { return units + 1; }
+
+        //  Doubles the tables until they hold battles of the given number of units a side
+        void reserve(int neededUnits)
+        {
+            if (static_cast<size_t>(neededUnits) <= units && !survivors.empty())
+                return;
+            size_t newUnits = std::max<size_t>(units, 16);
+            while (newUnits < static_cast<size_t>(neededUnits))
+                newUnits *= 2;
+            units = std::min<size_t>(newUnits, CombatOdds::MAX_TABLE_UNITS);
+            fill();
+        }
+
+        //  The attackers kill Bin(a, p) defenders and conquer if that is all of them, so by the first attacker's roll,
+        //  P[a][d] = p P[a - 1][d - 1] + (1 - p) P[a - 1][d]. The defenders kill Bin(d, q) attackers, independently, so
+        //  by the first defender's roll, S[a][d] = q S[a - 1][d - 1] + (1 - q) S[a][d - 1]
+        void fill()
+        {
+            const double p = ATTACKER_KILL_PROBABILITY;
+            const double q = DEFENDER_KILL_PROBABILITY;
+            conquestProbabilities.assign(stride() * stride(), 0.0);
+            survivors.assign(stride() * stride(), 0.0);
+            for (size_t a = 0; a <= units; a++)
+            {
+                conquestProbabilities[a * stride()] = 1.0;
+                survivors[a * stride()] = static_cast<double>(a);
+                for (size_t d = 1; d <= units && a > 0; d++)
+                {
+                    conquestProbabilities[a * stride() + d] = p * conquestProbabilities[(a - 1) * stride() + d - 1] +
+                                                              (1.0 - p) * conquestProbabilities[(a - 1) * stride() + d];
+                    survivors[a * stride() + d] =
+                        q * survivors[(a - 1) * stride() + d - 1] + (1.0 - q) * survivors[a * stride() + d - 1];
+                }
+            }
+        }
+    };
+
+    thread_local OddsTable oddsTable;
+
+    double normalCdf(double x)
+    {
+        return 0.5 * std::erfc(-x / std::sqrt(2.0));
+    }
+}
+
+double CombatOdds::conquestProbability(int attackers, int defenders)
+{
+    if (defenders <= 0)
+        return 1.0;
+    //  Fewer attackers than defenders cannot kill them all
+    if (attackers < defenders)
+        return 0.0;
+    if (attackers <= MAX_TABLE_UNITS)
+        return oddsTable.conquestProbability(attackers, defenders);
+
+    //  Kills of the attackers ~ N(a p, a p (1 - p)), with a continuity correction
+    const double mean = attackers * ATTACKER_KILL_PROBABILITY;
+    const double deviation = std::sqrt(mean * (1.0 - ATTACKER_KILL_PROBABILITY));
+    return 1.0 - normalCdf((defenders - 0.5 - mean) / deviation);
+}
+
+double CombatOdds::expectedSurvivors(int attackers, int defenders)
+{
+    if (attackers <= 0)
+        return 0.0;
+    if (defenders <= 0)
+        return attackers;
+    //  More attackers than defenders cannot all be killed: the expected losses are those of every defender
+    if (attackers > defenders)
+        return attackers - defenders * DEFENDER_KILL_PROBABILITY;
+    if (defenders <= MAX_TABLE_UNITS)
+        return oddsTable.expectedSurvivors(attackers, defenders);
+
+    //  Survivors ~ max(X, 0), with X = a - N(d q, d q (1 - q)): E[max(X, 0)] = mu Phi(mu / s) + s phi(mu / s)
+    const double mean = attackers - defenders * DEFENDER_KILL_PROBABILITY;
+    const double deviation = std::sqrt(defenders * DEFENDER_KILL_PROBABILITY * (1.0 - DEFENDER_KILL_PROBABILITY));
+    const double z = mean / deviation;
+    return mean * normalCdf(z) + deviation * std::exp(-0.5 * z * z) / std::sqrt(2.0 * std::numbers::pi);
+}
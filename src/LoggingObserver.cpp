@@ -1,6 +1,6 @@
 #include <iostream>
-#include <fstream>
 #include "../headers/LoggingObserver.h"
+#include "../headers/AsyncLogWriter.h"
 
 ILoggable::ILoggable()
 {
@@ -19,6 +19,11 @@ ILoggable &ILoggable::operator=(const ILoggable &)
     return *this;
 }
 
+LogEntry ILoggable::toLogEntry()
+{
+    return {};
+}
+
 ostream &operator<<(ostream &outs, const ILoggable &ILoggable)
 {
     return outs << "ILoggable";
@@ -36,6 +41,10 @@ Observer::~Observer()
 {
 }
 
+void Observer::Flush()
+{
+}
+
 Observer &Observer::operator=(const Observer &)
 {
     return *this;
@@ -46,14 +55,13 @@ ostream &operator<<(ostream &outs, const Observer &observer)
     return outs << "Observer";
 }
 
-Subject::Subject()
+Subject::Subject() : _observers(nullptr)
 {
-    _observers = new list<Observer *>;
 }
 
 Subject::Subject(Subject &subject)
+    : _observers(subject._observers != nullptr ? new list<Observer *>(*subject._observers) : nullptr)
 {
-    _observers = subject._observers;
 }
 
 Subject::~Subject()
@@ -63,38 +71,76 @@ Subject::~Subject()
 
 Subject &Subject::operator=(const Subject &subject)
 {
-    _observers = subject._observers;
+    if (this != &subject)
+    {
+        delete _observers;
+        _observers = subject._observers != nullptr ? new list<Observer *>(*subject._observers) : nullptr;
+    }
     return *this;
 }
 
 void Subject::Attach(Observer *o)
 {
+    if (_observers == nullptr)
+        _observers = new list<Observer *>;
+
+    for (Observer *observer : *_observers)
+    {
+        if (observer == o)
+            return;
+    }
     _observers->push_back(o);
 }
 
 void Subject::Detach(Observer *o)
 {
-    _observers->remove(o);
+    if (_observers != nullptr)
+        _observers->remove(o);
 }
 
 void Subject::notify(ILoggable *log)
 {
+    if (_observers == nullptr)
+        return;
+
     for (Observer *observer : *_observers)
     {
         observer->Update(log);
     }
 }
 
+void Subject::flushObservers()
+{
+    if (_observers == nullptr)
+        return;
+
+    for (Observer *observer : *_observers)
+    {
+        observer->Flush();
+    }
+}
+
+void Subject::attachObserversTo(Subject &other) const
+{
+    if (_observers == nullptr)
+        return;
+
+    for (Observer *observer : *_observers)
+    {
+        other.Attach(observer);
+    }
+}
+
 ostream &operator<<(ostream &outs, const Subject &observer)
 {
     return outs << "Subject";
 }
 
-LogObserver::LogObserver()
+LogObserver::LogObserver() : writer(make_shared<AsyncLogWriter>("gamelog.txt"))
 {
 }
 
-LogObserver::LogObserver(LogObserver &logObserver)
+LogObserver::LogObserver(LogObserver &logObserver) : writer(logObserver.writer)
 {
 }
 
@@ -104,22 +150,17 @@ LogObserver::~LogObserver()
 
 void LogObserver::Update(ILoggable *log)
 {
-    std::ofstream logFile("gamelog.txt");
-
-    if (logFile.is_open())
-    {
-        logFile << log->stringToLog() << std::endl;
+    writer->write(log->stringToLog());
+}
 
-        logFile.close();
-    }
-    else
-    {
-        std::cout << "Unable to open file." << std::endl;
-    }
+void LogObserver::Flush()
+{
+    writer->flush();
 }
 
-LogObserver &LogObserver::operator=(const LogObserver &)
+LogObserver &LogObserver::operator=(const LogObserver &logObserver)
 {
+    writer = logObserver.writer;
     return *this;
 }
 
@@ -1,5 +1,7 @@
 #include <iostream>
-#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cstdio>
 #include <memory>
 #include <vector>
 #include <string>
@@ -9,10 +11,13 @@
 #include "../headers/gameengine/TransitionFunctions.h"
 #include "../headers/commandprocessing/CommandProcessing.h"
 #include "../headers/LoggingObserver.h"
+#include "../headers/BinaryLogObserver.h"
 #include "../headers/player/Player.h"
 #include "../headers/Map.h"
 #include "../headers/Cards.h"
 
+Map *buildEuropeMap(Player *player1, Player *player2);
+
 void testLoggingObserver(CommandProcessor* commandProcessor)
 {
     Observer *observer = new LogObserver();
@@ -27,8 +32,9 @@ void testLoggingObserver(CommandProcessor* commandProcessor)
     auto *end = new State("END");
 
     //  Inserting the transitions
-    start->addTransition("loadmap", mapLoaded, 1, "loadmap [--filepath]", &game_loadMap);
-    mapLoaded->addTransition("loadmap", mapLoaded, 1, "loadmap [--filepath]", &game_loadMap);
+    start->addTransition("loadmap", mapLoaded, 1, "loadmap [--filepath] [-binary]", &game_loadMap);
+    start->addTransition("tournament", win, 8, "tournament -M [--mapfiles] -P [--strategies] -G [--games] -D [--maxturns] [-T [--threads]]", &game_tournament);
+    mapLoaded->addTransition("loadmap", mapLoaded, 1, "loadmap [--filepath] [-binary]", &game_loadMap);
     mapLoaded->addTransition("validatemap", mapValidated, 0, "validatemap", &game_validateMap);
     mapValidated->addTransition("addplayer", playersAdded, 1, "addplayer [--playername]", &game_addPlayer);
     playersAdded->addTransition("addplayer", playersAdded, 1, "addplayer [--playername]", &game_addPlayer);
@@ -61,19 +67,11 @@ void testLoggingObserver(CommandProcessor* commandProcessor)
     player2->addCard(*(new Card(type::airlift)));
     player2->addCard(*(new Card(type::diplomacy)));
 
-    auto *europe = new Continent("Europe", 100);
-
-    auto *france = new Territory("France", 5, 5, europe, player1, 5);
-    auto *belgium = new Territory("Belgium", 6, 4, europe, player1, 5);
-    auto *england = new Territory("England", 5, 3, europe, player2, 5);
-    auto *greece = new Territory("Greece", 10, 12, europe, player1, 5);
-
-    france->addAdjacentTerritory(belgium);
-    france->addAdjacentTerritory(england);
-    belgium->addAdjacentTerritory(france);
-    belgium->addAdjacentTerritory(england);
-    england->addAdjacentTerritory(france);
-    england->addAdjacentTerritory(belgium);
+    Map *map = buildEuropeMap(player1, player2);
+    Territory *france = map->getTerritoryByName("France");
+    Territory *belgium = map->getTerritoryByName("Belgium");
+    Territory *england = map->getTerritoryByName("England");
+    Territory *greece = map->getTerritoryByName("Greece");
 
     player1->issueOrder("deploy", france, 3, nullptr, nullptr);
     player1->issueOrder("advance", belgium, 4, france, nullptr);
@@ -91,12 +89,74 @@ void testLoggingObserver(CommandProcessor* commandProcessor)
 
     gameEngine->Detach(observer);
     delete gameEngine;
-    delete europe;
-    delete france;
-    delete belgium;
-    delete england;
-    delete greece;
+    delete map;
 
     delete player1;
     delete player2;
+
+    //  Deleting the observer writes out the rest of the log
+    delete observer;
+}
+
+/** \brief A loggable event that logs the same string every time. */
+class FixedLoggable : public ILoggable
+{
+public:
+    string stringToLog() override
+    {
+        return "Order Executed: Advance order: 12 units from Penzance to Truro, 7 defending units killed.";
+    }
+
+    LogEntry toLogEntry() override
+    {
+        LogEntry entry;
+        entry.kind = LogEventKind::OrderExecuted;
+        entry.orderType = 1;
+        entry.armies = 12;
+        entry.value = 5;
+        return entry;
+    }
+};
+
+/**
+ * \brief   Times a log update: opening, appending to and closing the log file every time (how logs used to be
+ *          written), against queueing the line for the background writer of 'LogObserver', and against appending a
+ *          record to the mapped file of 'BinaryLogObserver'.
+ */
+void benchmarkLogging()
+{
+    const int syncLines = 20000;
+    const int asyncLines = 1000000;
+    FixedLoggable loggable;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < syncLines; i++)
+    {
+        std::ofstream logFile("gamelog_sync.txt", std::ios::app);
+        logFile << loggable.stringToLog() << std::endl;
+    }
+    double syncTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::remove("gamelog_sync.txt");
+
+    Observer *observer = new LogObserver();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < asyncLines; i++)
+        observer->Update(&loggable);
+    double queueTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    observer->Flush();
+    double totalTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    delete observer;
+
+    observer = new BinaryLogObserver("gamelog_benchmark.bin");
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < asyncLines; i++)
+        observer->Update(&loggable);
+    double binaryTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    delete observer;
+    std::remove("gamelog_benchmark.bin");
+
+    std::cout << "Open/append/close per line:     " << syncTime / syncLines << " ns per line" << std::endl;
+    std::cout << "Queued for the writer thread:   " << queueTime / asyncLines << " ns per line" << std::endl;
+    std::cout << "Queued and flushed to the file: " << totalTime / asyncLines << " ns per line" << std::endl;
+    std::cout << "Binary record (mapped file):    " << binaryTime / asyncLines << " ns per record" << std::endl;
 }
\ No newline at end of file
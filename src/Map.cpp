@@ -1,28 +1,36 @@
 #include <iostream>
 #include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
 
 #include "../headers/Map.h"
+#include "../headers/DynamicBitset.h"
+#include "../headers/MappedFile.h"
+#include "../headers/ThreadPool.h"
+#include "../headers/gameengine/GameOutput.h"
 #include "../headers/player/Player.h"
 
 
 
 // Territory Implementation
 
-Territory::Territory(const std::string &name, int xCoord, int yCoord, Continent *cont, Player *owner, int armies)
-    : name(name), x(xCoord), y(yCoord), continent(cont), owner(owner), numberOfArmies(armies)
+Territory::Territory(std::string name, int xCoord, int yCoord, Continent *cont, Player *owner, int armies)
+    : name(std::move(name)), x(xCoord), y(yCoord), continent(cont), owner(owner), numberOfArmies(armies)
 {
     if (owner)
         owner->addTerritory(*this);
 }
 
 // Copy constructor
+// The copy owns its adjacency storage; it does not share the CSR storage of the original territory's map
 Territory::Territory(const Territory &other)
-    : name(other.name), x(other.x), y(other.y), continent(other.continent), owner(other.owner), numberOfArmies(other.numberOfArmies)
+    : name(other.name), x(other.x), y(other.y), continent(other.continent), owner(other.owner), numberOfArmies(other.numberOfArmies),
+      ownedAdjacency(other.adjacentTerritories.begin(), other.adjacentTerritories.end()), id(other.id)
 {
-    for (Territory *territory : other.adjacentTerritories)
-    {
-        adjacentTerritories.push_back(territory);
-    }
+    adjacentTerritories = ownedAdjacency;
 }
 
 // Assignment operator
@@ -36,14 +44,11 @@ Territory &Territory::operator=(const Territory &other)
         continent = other.continent;
         owner = other.owner;
         numberOfArmies = other.numberOfArmies;
+        id = other.id;
 
-        // Clear current adjacent territories
-        adjacentTerritories.clear();
-
-        for (Territory *territory : other.adjacentTerritories)
-        {
-            adjacentTerritories.push_back(territory);
-        }
+        // Replace current adjacent territories
+        ownedAdjacency.assign(other.adjacentTerritories.begin(), other.adjacentTerritories.end());
+        adjacentTerritories = ownedAdjacency;
     }
     return *this;
 }
@@ -70,14 +75,20 @@ std::ostream &operator<<(std::ostream &os, const Territory &territory)
     return os;
 }
 
-std::string Territory::getName() const
+const std::string &Territory::getName() const
 {
     return name;
 }
 
 void Territory::addAdjacentTerritory(Territory *adjTerritory)
 {
-    adjacentTerritories.push_back(adjTerritory);
+    // If the adjacency currently lives in the map's CSR storage, take a private copy before modifying it
+    if (adjacentTerritories.data() != ownedAdjacency.data())
+    {
+        ownedAdjacency.assign(adjacentTerritories.begin(), adjacentTerritories.end());
+    }
+    ownedAdjacency.push_back(adjTerritory);
+    adjacentTerritories = ownedAdjacency;
 }
 
 Continent *Territory::getContinent() const
@@ -85,13 +96,8 @@ Continent *Territory::getContinent() const
     return continent;
 }
 
-std::vector<Territory *> Territory::getAdjacentTerritories() const
-{
-    return adjacentTerritories;
-}
-
 bool Territory::isTerritoryAdjacent(Territory *territory) const {
-    return find(begin(adjacentTerritories), end(adjacentTerritories), territory) != end(adjacentTerritories);
+    return std::ranges::find(adjacentTerritories, territory) != adjacentTerritories.end();
 }
 
 void Territory::setOwner(Player *newOwner)
@@ -120,7 +126,7 @@ Territory::~Territory() = default;
 
 // Continent Implementation
 
-Continent::Continent(const std::string &name, int bonusValue) : name(name), bonus(bonusValue) {}
+Continent::Continent(std::string name, int bonusValue) : name(std::move(name)), bonus(bonusValue) {}
 
 // Copy constructor
 Continent::Continent(const Continent &other)
@@ -151,7 +157,7 @@ std::ostream &operator<<(std::ostream &os, const Continent &continent)
     return os;
 }
 
-std::string Continent::getName() const
+const std::string &Continent::getName() const
 {
     return name;
 }
@@ -166,11 +172,6 @@ void Continent::addTerritory(Territory *territory)
     territories.push_back(territory);
 }
 
-std::vector<Territory *> Continent::getTerritories() const
-{
-    return territories;
-}
-
 // Map Implementation
 
 Map::Map() {}
@@ -178,16 +179,7 @@ Map::Map() {}
 // Copy constructor
 Map::Map(const Map &other)
 {
-    // Deep copy continents
-    for (const auto &continent : other.continents)
-    {
-        continents.push_back(new Continent(*continent));
-    }
-    // Deep copy territories
-    for (const auto &territory : other.territories)
-    {
-        territories.push_back(new Territory(*territory));
-    }
+    copyFrom(other);
 }
 
 // Assignment operator
@@ -207,18 +199,47 @@ Map &Map::operator=(const Map &other)
         territories.clear();
         continents.clear();
 
-        // Deep copy continents
-        for (const auto &continent : other.continents)
+        copyFrom(other);
+    }
+    return *this;
+}
+
+void Map::copyFrom(const Map &other)
+{
+    isValid = other.isValid;
+
+    // Deep copy continents, without their territory lists (re-filled below with the copied territories)
+    continents.reserve(other.continents.size());
+    for (const auto &continent : other.continents)
+    {
+        auto *copy = new Continent(continent->getName(), continent->getBonus());
+        copy->id = continent->id;
+        continents.push_back(copy);
+    }
+
+    // Deep copy territories, pointing them to the copied continents
+    territories.reserve(other.territories.size());
+    for (const auto &territory : other.territories)
+    {
+        auto *copy = new Territory(*territory);
+        if (territory->continent)
         {
-            continents.push_back(new Continent(*continent));
+            copy->continent = continents[territory->continent->id];
+            copy->continent->addTerritory(copy);
         }
-        // Deep copy territories
-        for (const auto &territory : other.territories)
+        territories.push_back(copy);
+    }
+
+    // Copy the adjacency, translating the neighbours to the copied territories
+    for (Territory *territory : territories)
+    {
+        for (Territory *&neighbour : territory->ownedAdjacency)
         {
-            territories.push_back(new Territory(*territory));
+            neighbour = territories[neighbour->id];
         }
     }
-    return *this;
+    buildAdjacency();
+    rebuildNameIndices();
 }
 
 // Stream insertion operator
@@ -256,7 +277,6 @@ std::ostream &operator<<(std::ostream &os, const Map &map)
 // Destructor
 Map::~Map()
 {
-/*
     // Delete all territories
     for (Territory *territory : territories)
     {
@@ -268,41 +288,95 @@ Map::~Map()
     {
         delete continent;
     }
- */
 }
 
 void Map::addTerritory(Territory *territory)
 {
+    // The first territory registered under a name keeps the name
+    territoryIndex.try_emplace(territory->getName(), territories.size());
+    territory->id = territories.size();
     territories.push_back(territory);
 }
 
 void Map::addContinent(Continent *continent)
 {
+    // The first continent registered under a name keeps the name
+    continentIndex.try_emplace(continent->getName(), continents.size());
+    continent->id = continents.size();
     continents.push_back(continent);
 }
 
-Continent *Map::getContinentByName(const std::string &name) const
+void Map::buildAdjacency()
 {
-    for (const auto &continent : continents)
+    std::vector<size_t> offsets;
+    std::vector<Territory *> neighbours;
+    offsets.reserve(territories.size() + 1);
+    offsets.push_back(0);
+
+    size_t totalNeighbours = 0;
+    for (const Territory *territory : territories)
     {
-        if (continent->getName() == name)
-        {
-            return continent;
-        }
+        totalNeighbours += territory->adjacentTerritories.size();
     }
-    return nullptr;
+    neighbours.reserve(totalNeighbours);
+
+    for (const Territory *territory : territories)
+    {
+        neighbours.insert(neighbours.end(), territory->adjacentTerritories.begin(), territory->adjacentTerritories.end());
+        offsets.push_back(neighbours.size());
+    }
+
+    setAdjacency(std::move(offsets), std::move(neighbours));
 }
 
-Territory *Map::getTerritoryByName(const std::string &name) const
+void Map::setAdjacency(std::vector<size_t> offsets, std::vector<Territory *> neighbours)
 {
-    for (auto &territory : territories)
+    adjacencyOffsets = std::move(offsets);
+    adjacency = std::move(neighbours);
+
+    // Rebind each territory's view to the packed storage and release the per-territory vectors
+    for (size_t i = 0; i < territories.size(); ++i)
     {
-        if (territory->getName() == name)
-        {
-            return territory;
-        }
+        territories[i]->adjacentTerritories = getAdjacentTerritories(i);
+        std::vector<Territory *>().swap(territories[i]->ownedAdjacency);
     }
-    return nullptr;
+}
+
+void Map::reserve(size_t numContinents, size_t numTerritories)
+{
+    continents.reserve(numContinents);
+    territories.reserve(numTerritories);
+    continentIndex.reserve(numContinents);
+    territoryIndex.reserve(numTerritories);
+}
+
+void Map::rebuildNameIndices()
+{
+    continentIndex.clear();
+    territoryIndex.clear();
+    continentIndex.reserve(continents.size());
+    territoryIndex.reserve(territories.size());
+
+    for (size_t i = 0; i < continents.size(); ++i)
+    {
+        continentIndex.try_emplace(continents[i]->getName(), i);
+    }
+    for (size_t i = 0; i < territories.size(); ++i)
+    {
+        territoryIndex.try_emplace(territories[i]->getName(), i);
+    }
+}
+
+Continent *Map::getContinentByName(std::string_view name) const
+{
+    auto it = continentIndex.find(name);
+    return it != continentIndex.end() ? continents[it->second] : nullptr;
+}
+
+Territory *Map::getTerritoryByName(std::string_view name) const
+{
+    auto it = territoryIndex.find(name);
+    return it != territoryIndex.end() ? territories[it->second] : nullptr;
 }
 
 const std::vector<Continent *> &Map::getContinents() const
@@ -310,10 +384,64 @@ const std::vector<Continent *> &Map::getContinents() const
     return continents;
 }
 
+/** \brief Prints up to a fixed number of names from a list of failing territories/continents, then a count of the
+ *         remainder. Keeps the report readable on maps with tens of thousands of territories. */
+template <typename T>
+static void printFailures(const std::vector<const T *> &failures)
+{
+    const size_t maxPrinted = 10;
+    for (size_t i = 0; i < failures.size() && i < maxPrinted; ++i)
+    {
+        std::cerr << "  - " << failures[i]->getName() << "\n";
+    }
+    if (failures.size() > maxPrinted)
+    {
+        std::cerr << "  ... and " << failures.size() - maxPrinted << " more\n";
+    }
+}
+
+/** \brief Disjoint-set forest over territory ids, with path halving and union by size. */
+class TerritoryUnionFind
+{
+public:
+    explicit TerritoryUnionFind(size_t size) : parent(size), componentSize(size, 1)
+    {
+        for (size_t i = 0; i < size; ++i)
+            parent[i] = i;
+    }
+
+    size_t find(size_t id)
+    {
+        while (parent[id] != id)
+        {
+            parent[id] = parent[parent[id]];
+            id = parent[id];
+        }
+        return id;
+    }
+
+    void unite(size_t a, size_t b)
+    {
+        a = find(a);
+        b = find(b);
+        if (a == b)
+            return;
+        if (componentSize[a] < componentSize[b])
+            std::swap(a, b);
+        parent[b] = a;
+        componentSize[a] += componentSize[b];
+    }
+
+private:
+    std::vector<size_t> parent;
+    std::vector<size_t> componentSize;
+};
+
 // Check if the map is connected, continents are sub-graphs, and each territory belongs to only one continent.
+// Every check works on territory ids (indices into 'territories'), so the whole validation is O(V + E).
 bool Map::validate() const
 {
-    std::cout << "Validating map...\n";
+    gameOut() << "Validating map...\n";
 
     // Check if the map is deemed invalid during loading
     if (!getIsValid())
@@ -321,77 +449,151 @@ bool Map::validate() const
         return false;
     }
 
-    // Check 1: Map is connected
-    if (territories.size() > 0 && !isConnected(*territories[0], territories))
+    bool valid = true;
+    const size_t numTerritories = territories.size();
+
+    // Check 1: Map is connected (every territory reachable from the first one)
+    if (numTerritories > 0)
     {
-        std::cerr << "Error: Map is not connected!\n";
-        return false;
+        DynamicBitset visited(numTerritories);
+        std::vector<size_t> queue;
+        queue.reserve(numTerritories);
+        queue.push_back(0);
+        visited.set(0);
+
+        for (size_t head = 0; head < queue.size(); ++head)
+        {
+            for (const Territory *adjTerritory : territories[queue[head]]->getAdjacentTerritories())
+            {
+                size_t adjId = adjTerritory->getId();
+                if (!visited.test(adjId))
+                {
+                    visited.set(adjId);
+                    queue.push_back(adjId);
+                }
+            }
+        }
+
+        if (queue.size() != numTerritories)
+        {
+            std::vector<const Territory *> unreachable;
+            for (size_t id = 0; id < numTerritories; ++id)
+            {
+                if (!visited.test(id))
+                    unreachable.push_back(territories[id]);
+            }
+            std::cerr << "Error: Map is not connected! " << unreachable.size() << " territories cannot be reached from \""
+                      << territories[0]->getName() << "\":\n";
+            printFailures(unreachable);
+            valid = false;
+        }
     }
 
-    // Check 2: Continents are connected sub-graphs
+    // Check 3: Each territory belongs to one and only one continent
+    // 'continentOf' records the continent of each territory that belongs to exactly one continent
+    const size_t noContinent = continents.size();
+    std::vector<size_t> continentOf(numTerritories, noContinent);
+    std::vector<unsigned> membershipCount(numTerritories, 0);
     for (const auto &continent : continents)
     {
-        if (continent->getTerritories().size() > 0 && !isConnected(*(continent->getTerritories()[0]), continent->getTerritories()))
+        for (const Territory *contTerritory : continent->getTerritories())
         {
-            std::cerr << "Error: Continents are not connected sub-graphs!\n";
-            return false;
+            membershipCount[contTerritory->getId()]++;
+            continentOf[contTerritory->getId()] = continent->getId();
         }
     }
 
-    // Check 3: Each territory belongs to one and only one continent
-    for (const auto &territory : territories)
+    std::vector<const Territory *> badMembership;
+    for (size_t id = 0; id < numTerritories; ++id)
     {
-        int count = 0;
-        for (const auto &continent : continents)
+        if (membershipCount[id] != 1)
         {
-            for (const auto &contTerritory : continent->getTerritories())
-            {
-                if (territory->getName() == contTerritory->getName())
-                {
-                    count++;
-                }
-            }
+            badMembership.push_back(territories[id]);
+            continentOf[id] = noContinent;
         }
-        if (count != 1)
+    }
+    if (!badMembership.empty())
+    {
+        std::cerr << "Error: " << badMembership.size() << " territories do not belong to one and only one continent:\n";
+        printFailures(badMembership);
+        valid = false;
+    }
+
+    // Check 2: Continents are connected sub-graphs
+    // Union every edge whose endpoints share a continent, then each continent must form a single set
+    TerritoryUnionFind components(numTerritories);
+    for (size_t id = 0; id < numTerritories; ++id)
+    {
+        if (continentOf[id] == noContinent)
+            continue;
+
+        for (const Territory *adjTerritory : territories[id]->getAdjacentTerritories())
         {
-            std::cerr << "Error: Territory does not belong to one and only one continent!\n";
-            return false;
+            if (continentOf[adjTerritory->getId()] == continentOf[id])
+                components.unite(id, adjTerritory->getId());
         }
     }
 
-    return true;
+    // Members that do not belong to one and only one continent were reported above, and are left out
+    std::vector<const Continent *> disconnected;
+    for (const auto &continent : continents)
+    {
+        auto isMember = [&](const Territory *member)
+        { return continentOf[member->getId()] == continent->getId(); };
+        const auto &members = continent->territories;
+        auto first = std::find_if(members.begin(), members.end(), isMember);
+        if (first == members.end())
+            continue;
+
+        size_t root = components.find((*first)->getId());
+        bool connected = std::all_of(first, members.end(), [&](const Territory *member)
+                                     { return !isMember(member) || components.find(member->getId()) == root; });
+        if (!connected)
+            disconnected.push_back(continent);
+    }
+    if (!disconnected.empty())
+    {
+        std::cerr << "Error: " << disconnected.size() << " continents are not connected sub-graphs:\n";
+        printFailures(disconnected);
+        valid = false;
+    }
+
+    return valid;
 }
 
-// DFS Check if a given territory is connected to all other territories in a given list
+// BFS Check if a given territory is connected to all other territories in a given list
 bool Map::isConnected(const Territory &territory, const std::vector<Territory *> &territoryList) const
 {
-    std::unordered_set<std::string> visited;
-    std::stack<const Territory *> stack;
-
-    stack.push(&territory);
+    // Territory ids are map indices, so membership and visited sets are plain bit vectors
+    size_t idLimit = territories.size();
+    for (const Territory *listed : territoryList)
+    {
+        idLimit = std::max(idLimit, listed->getId() + 1);
+    }
 
-    while (!stack.empty())
+    DynamicBitset inList(idLimit);
+    for (const Territory *listed : territoryList)
     {
-        const Territory *currTerritory = stack.top();
-        stack.pop();
-        visited.insert(currTerritory->getName());
+        inList.set(listed->getId());
+    }
 
-        for (const auto &adjTerritory : currTerritory->getAdjacentTerritories())
+    DynamicBitset visited(idLimit);
+    std::vector<const Territory *> queue = {&territory};
+    visited.set(territory.getId());
+
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        for (const Territory *adjTerritory : queue[head]->getAdjacentTerritories())
         {
-            if (visited.find(adjTerritory->getName()) == visited.end() && territoryExistsInList(adjTerritory, territoryList))
+            size_t adjId = adjTerritory->getId();
+            if (inList.test(adjId) && !visited.test(adjId))
             {
-                stack.push(adjTerritory);
+                visited.set(adjId);
+                queue.push_back(adjTerritory);
             }
         }
     }
-    return visited.size() == territoryList.size();
-}
-
-bool Map::territoryExistsInList(const Territory *territory, const std::vector<Territory *> &territoryList) const
-{
-    return std::find_if(territoryList.begin(), territoryList.end(),
-                        [&territory](const Territory *t)
-                        { return t->getName() == territory->getName(); }) != territoryList.end();
+    return queue.size() == territoryList.size();
 }
 
 // Print out valid maps
@@ -432,17 +634,21 @@ void Map::printMap() const
 
 // MapLoader implementation
 
-MapLoader::MapLoader(const std::string &filePath) : filePath(filePath) {}
+MapLoader::MapLoader(const std::string &filePath, Mode mode, unsigned numThreads)
+    : filePath(filePath), mode(mode), numThreads(numThreads) {}
 
 // Copy constructor
-MapLoader::MapLoader(const MapLoader &other) : filePath(other.filePath),
-                                               parsedTerritoryAdjacencies(other.parsedTerritoryAdjacencies) {}
+// Parsed adjacencies are transient views into a file being loaded, so they are not copied
+MapLoader::MapLoader(const MapLoader &other) : filePath(other.filePath), mode(other.mode), numThreads(other.numThreads) {}
 
 // Assignment operator
 MapLoader &MapLoader::operator=(MapLoader other)
 {
     std::swap(filePath, other.filePath);
-    std::swap(parsedTerritoryAdjacencies, other.parsedTerritoryAdjacencies);
+    std::swap(mode, other.mode);
+    std::swap(numThreads, other.numThreads);
+    std::swap(adjacencyNames, other.adjacencyNames);
+    std::swap(adjacencyNameOffsets, other.adjacencyNameOffsets);
     return *this;
 }
 
@@ -450,16 +656,20 @@ MapLoader &MapLoader::operator=(MapLoader other)
 std::ostream &operator<<(std::ostream &os, const MapLoader &loader)
 {
     os << "MapLoader for file: " << loader.filePath << std::endl;
-    os << "Parsed Territory Adjacencies:\n";
-    for (const auto &pair : loader.parsedTerritoryAdjacencies)
+    os << "Load mode: ";
+    switch (loader.mode)
     {
-        os << pair.first << ": ";
-        for (const auto &adjacentName : pair.second)
-        {
-            os << adjacentName << ", ";
-        }
-        os << std::endl;
+    case MapLoader::Mode::Buffered:
+        os << "buffered";
+        break;
+    case MapLoader::Mode::MemoryMapped:
+        os << "memory mapped";
+        break;
+    case MapLoader::Mode::Parallel:
+        os << "parallel (" << (loader.numThreads == 0 ? ThreadPool::hardwareThreads() : loader.numThreads) << " threads)";
+        break;
     }
+    os << std::endl;
     return os;
 }
 
@@ -471,82 +681,506 @@ enum class ParseState
 };
 
 // Ignore white spaces and carriage return
-std::string MapLoader::trim(const std::string &str)
+std::string_view MapLoader::trim(std::string_view str)
 {
     size_t start = str.find_first_not_of(" \t\r");
     size_t end = str.find_last_not_of(" \t\r");
-    if (start == std::string::npos || end == std::string::npos)
+    if (start == std::string_view::npos || end == std::string_view::npos)
     {
-        return "";
+        return {};
     }
     return str.substr(start, end - start + 1);
 }
 
+/** \brief Splits off the text up to the next delimiter, advancing 'rest' past it. Mirrors 'std::getline' semantics:
+ *         the whole remainder is returned if there is no delimiter. */
+static std::string_view nextToken(std::string_view &rest, char delimiter)
+{
+    size_t end = rest.find(delimiter);
+    std::string_view token = rest.substr(0, end);
+    rest = end == std::string_view::npos ? std::string_view{} : rest.substr(end + 1);
+    return token;
+}
+
+/** \brief Parses a (possibly space padded) integer, ignoring trailing characters like 'stoi' does.
+ *  \return True if an integer could be parsed. */
+static bool parseInt(std::string_view token, int &value)
+{
+    size_t start = token.find_first_not_of(" \t\r");
+    if (start == std::string_view::npos)
+    {
+        return false;
+    }
+    const char *first = token.data() + start;
+    if (*first == '+')
+    {
+        ++first;
+    }
+    return std::from_chars(first, token.data() + token.size(), value).ec == std::errc{};
+}
+
 // Loop over all territories and link them to their adjacent territories
-// For each territory, find its adjacent territories by name and add a pointer to them
+// For each territory, resolve its adjacent territories by name through the map's name index and pack them into the
+// map's CSR adjacency storage
 void MapLoader::linkAdjacentTerritories(Map &map)
 {
-    for (const auto &territoryData : parsedTerritoryAdjacencies)
+    const size_t numTerritories = map.getNumTerritories();
+    const auto &territories = map.getTerritories();
+
+    std::vector<size_t> offsets;
+    std::vector<Territory *> neighbours;
+    offsets.reserve(numTerritories + 1);
+    neighbours.reserve(adjacencyNames.size());
+    offsets.push_back(0);
+
+    for (size_t id = 0; id < numTerritories; ++id)
     {
-        Territory *territory = map.getTerritoryByName(territoryData.first);
+        // Keep any adjacency that was linked by hand, then append the parsed one
+        std::span<Territory *const> existing = territories[id]->getAdjacentTerritories();
+        neighbours.insert(neighbours.end(), existing.begin(), existing.end());
 
-        if (!territory)
-            continue;
+        if (id + 1 < adjacencyNameOffsets.size())
+        {
+            for (size_t i = adjacencyNameOffsets[id]; i < adjacencyNameOffsets[id + 1]; ++i)
+            {
+                Territory *adjacentTerritory = map.getTerritoryByName(adjacencyNames[i]);
+                if (adjacentTerritory)
+                {
+                    neighbours.push_back(adjacentTerritory);
+                }
+            }
+        }
+        offsets.push_back(neighbours.size());
+    }
+
+    map.setAdjacency(std::move(offsets), std::move(neighbours));
+}
+
+// Same as above, but the name lookups, which dominate the cost, are spread over the thread pool
+void MapLoader::linkAdjacentTerritories(Map &map, ThreadPool &pool)
+{
+    const size_t numTerritories = map.getNumTerritories();
+    const auto &territories = map.getTerritories();
+
+    // Resolve every name concurrently; each task writes its own slice, unresolved names stay nullptr
+    std::vector<Territory *> resolved(adjacencyNames.size(), nullptr);
+    const size_t numChunks = pool.size() * 4;
+    const size_t chunkSize = resolved.size() / numChunks + 1;
+    std::vector<std::future<void>> tasks;
+    for (size_t begin = 0; begin < resolved.size(); begin += chunkSize)
+    {
+        size_t end = std::min(begin + chunkSize, resolved.size());
+        tasks.push_back(pool.submit([this, &map, &resolved, begin, end]() {
+            for (size_t i = begin; i < end; ++i)
+            {
+                resolved[i] = map.getTerritoryByName(adjacencyNames[i]);
+            }
+        }));
+    }
+    for (auto &task : tasks)
+    {
+        task.get();
+    }
+
+    // Pack the resolved names into the CSR, in order
+    std::vector<size_t> offsets;
+    std::vector<Territory *> neighbours;
+    offsets.reserve(numTerritories + 1);
+    neighbours.reserve(resolved.size());
+    offsets.push_back(0);
+
+    for (size_t id = 0; id < numTerritories; ++id)
+    {
+        // Keep any adjacency that was linked by hand, then append the parsed one
+        std::span<Territory *const> existing = territories[id]->getAdjacentTerritories();
+        neighbours.insert(neighbours.end(), existing.begin(), existing.end());
 
-        for (const auto &adjName : territoryData.second)
+        if (id + 1 < adjacencyNameOffsets.size())
         {
-            Territory *adjacentTerritory = map.getTerritoryByName(adjName);
-            if (adjacentTerritory)
+            for (size_t i = adjacencyNameOffsets[id]; i < adjacencyNameOffsets[id + 1]; ++i)
             {
-                territory->addAdjacentTerritory(adjacentTerritory);
+                if (resolved[i])
+                {
+                    neighbours.push_back(resolved[i]);
+                }
             }
         }
+        offsets.push_back(neighbours.size());
     }
+
+    map.setAdjacency(std::move(offsets), std::move(neighbours));
 }
 
 // Load map file
 Map *MapLoader::load()
 {
-    Map *map = new Map();
+    // Bring the whole file into memory, either mapped or read into a single buffer
+    MappedFile mappedFile;
+    std::string buffer;
+    std::string_view contents;
+    bool opened;
+
+    if (mode == Mode::MemoryMapped || mode == Mode::Parallel)
+    {
+        opened = mappedFile.open(filePath);
+        contents = mappedFile.view();
+    }
+    else
+    {
+        std::ifstream file(filePath, std::ios::binary);
+        opened = file.is_open();
+        if (opened)
+        {
+            buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        contents = buffer;
+    }
 
     // Check if file exists
-    std::ifstream file(filePath);
-    if (!file.is_open())
+    if (!opened)
     {
-        (*map).setIsValid(false);
         std::cerr << "Error: Failed to open the map file. \"" << filePath << "\" does not exist!\n";
-        delete map;
         return nullptr;
     }
     else
     {
-        std::cout << "Successfully opened \"" << filePath << "\"\n";
+        gameOut() << "Successfully opened \"" << filePath << "\"\n";
     }
 
     // Check if file is empty
-    if (file.peek() == EOF)
+    if (contents.empty())
     {
-        (*map).setIsValid(false);
         std::cerr << "Error: File is empty!\n";
+        return nullptr;
+    }
+
+    Map *map = new Map();
+
+    // The pool only lives for the duration of the load
+    std::unique_ptr<ThreadPool> pool;
+    if (mode == Mode::Parallel)
+    {
+        pool = std::make_unique<ThreadPool>(numThreads);
+    }
+
+    if (!(pool ? parseParallel(contents, *map, *pool) : parse(contents, *map)))
+    {
+        map->setIsValid(false);
         delete map;
+        adjacencyNames.clear();
+        adjacencyNameOffsets.clear();
         return nullptr;
     }
 
-    std::string line;
+    // Once loaded all the territories, link them to their adjacent territories.
+    if (pool)
+    {
+        linkAdjacentTerritories(*map, *pool);
+    }
+    else
+    {
+        linkAdjacentTerritories(*map);
+    }
+
+    // The parsed adjacency names are views into the file contents, which are released on return
+    adjacencyNames.clear();
+    adjacencyNameOffsets.clear();
+
+    gameOut() << "Loaded " << (*map).getNumContinents() << " continents.\n";
+    gameOut() << "Loaded " << (*map).getNumTerritories() << " territories.\n\n";
+
+    return map;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Binary map format
+//
+//  All values are 32 bit, in native byte order, laid out back to back:
+//      BinaryMapHeader
+//      BinaryContinent  x numContinents
+//      BinaryTerritory  x numTerritories
+//      uint32_t         x (numTerritories + 1)     CSR adjacency offsets
+//      uint32_t         x numAdjacency             CSR adjacency targets (territory ids)
+//      char             x stringTableSize          every name, back to back, not terminated
+
+namespace
+{
+    constexpr char BINARY_MAP_MAGIC[8] = {'R', 'I', 'S', 'K', 'M', 'A', 'P', '\0'};
+    constexpr uint32_t BINARY_MAP_VERSION = 1;
+    constexpr uint32_t BINARY_MAP_BYTE_ORDER = 0x01020304;
+
+    struct BinaryMapHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrder;
+        uint32_t isValid;
+        uint32_t numContinents;
+        uint32_t numTerritories;
+        uint32_t numAdjacency;
+        uint32_t stringTableSize;
+        uint32_t reserved;
+    };
+
+    struct BinaryContinent
+    {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        int32_t bonus;
+    };
+
+    struct BinaryTerritory
+    {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        int32_t x;
+        int32_t y;
+        uint32_t continent;
+    };
+
+    /** \brief Appends the raw bytes of trivially copyable values to a byte buffer. */
+    template <typename T>
+    void appendBytes(std::string &buffer, const T *values, size_t count)
+    {
+        buffer.append(reinterpret_cast<const char *>(values), sizeof(T) * count);
+    }
+}
+
+bool MapLoader::writeBinary(const Map &map, const std::string &binaryPath)
+{
+    const auto &continents = map.getContinents();
+    const auto &territories = map.getTerritories();
+
+    std::string strings;
+    std::vector<BinaryContinent> continentTable;
+    std::vector<BinaryTerritory> territoryTable;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> targets;
+    continentTable.reserve(continents.size());
+    territoryTable.reserve(territories.size());
+    offsets.reserve(territories.size() + 1);
+
+    for (const Continent *continent : continents)
+    {
+        continentTable.push_back({static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(continent->getName().size()),
+                                  continent->getBonus()});
+        strings += continent->getName();
+    }
+
+    offsets.push_back(0);
+    for (const Territory *territory : territories)
+    {
+        uint32_t continentId = territory->getContinent() ? static_cast<uint32_t>(territory->getContinent()->getId())
+                                                         : static_cast<uint32_t>(continents.size());
+        territoryTable.push_back({static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(territory->getName().size()),
+                                  territory->getX(), territory->getY(), continentId});
+        strings += territory->getName();
+
+        for (const Territory *adjacent : territory->getAdjacentTerritories())
+        {
+            targets.push_back(static_cast<uint32_t>(adjacent->getId()));
+        }
+        offsets.push_back(static_cast<uint32_t>(targets.size()));
+    }
+
+    BinaryMapHeader header{};
+    std::copy(std::begin(BINARY_MAP_MAGIC), std::end(BINARY_MAP_MAGIC), header.magic);
+    header.version = BINARY_MAP_VERSION;
+    header.byteOrder = BINARY_MAP_BYTE_ORDER;
+    header.isValid = map.getIsValid() ? 1 : 0;
+    header.numContinents = static_cast<uint32_t>(continentTable.size());
+    header.numTerritories = static_cast<uint32_t>(territoryTable.size());
+    header.numAdjacency = static_cast<uint32_t>(targets.size());
+    header.stringTableSize = static_cast<uint32_t>(strings.size());
+
+    std::string buffer;
+    buffer.reserve(sizeof(header) + sizeof(BinaryContinent) * continentTable.size() +
+                   sizeof(BinaryTerritory) * territoryTable.size() + sizeof(uint32_t) * (offsets.size() + targets.size()) +
+                   strings.size());
+    appendBytes(buffer, &header, 1);
+    appendBytes(buffer, continentTable.data(), continentTable.size());
+    appendBytes(buffer, territoryTable.data(), territoryTable.size());
+    appendBytes(buffer, offsets.data(), offsets.size());
+    appendBytes(buffer, targets.data(), targets.size());
+    buffer += strings;
+
+    // Write to a temporary file first, so that concurrent readers never see a partially written sidecar
+    std::string temporaryPath = binaryPath + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open() || !file.write(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+        {
+            std::cerr << "Error: Failed to write the binary map file \"" << binaryPath << "\"!\n";
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, binaryPath, error);
+    if (error)
+    {
+        std::filesystem::remove(temporaryPath, error);
+        std::cerr << "Error: Failed to write the binary map file \"" << binaryPath << "\"!\n";
+        return false;
+    }
+    return true;
+}
+
+Map *MapLoader::loadBinary(const std::string &binaryPath)
+{
+    MappedFile file(binaryPath);
+    if (!file.isOpen())
+    {
+        std::cerr << "Error: Failed to open the binary map file \"" << binaryPath << "\"!\n";
+        return nullptr;
+    }
+
+    // Validate the header and that every table fits in the file before touching any of them
+    BinaryMapHeader header{};
+    if (file.size() < sizeof(header))
+    {
+        std::cerr << "Error: \"" << binaryPath << "\" is not a binary map file!\n";
+        return nullptr;
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    if (!std::equal(std::begin(BINARY_MAP_MAGIC), std::end(BINARY_MAP_MAGIC), header.magic) ||
+        header.version != BINARY_MAP_VERSION || header.byteOrder != BINARY_MAP_BYTE_ORDER)
+    {
+        std::cerr << "Error: \"" << binaryPath << "\" is not a compatible binary map file!\n";
+        return nullptr;
+    }
+
+    const uint64_t expectedSize = sizeof(header) + sizeof(BinaryContinent) * uint64_t{header.numContinents} +
+                                  sizeof(BinaryTerritory) * uint64_t{header.numTerritories} +
+                                  sizeof(uint32_t) * (uint64_t{header.numTerritories} + 1 + header.numAdjacency) +
+                                  header.stringTableSize;
+    if (file.size() != expectedSize)
+    {
+        std::cerr << "Error: The binary map file \"" << binaryPath << "\" is truncated or corrupted!\n";
+        return nullptr;
+    }
+
+    // Copy the tables out of the mapping; the mapping is not guaranteed to be suitably aligned for direct access
+    const char *cursor = file.data() + sizeof(header);
+    auto readTable = [&cursor]<typename T>(std::vector<T> &table, size_t count)
+    {
+        table.resize(count);
+        std::memcpy(table.data(), cursor, sizeof(T) * count);
+        cursor += sizeof(T) * count;
+    };
+
+    std::vector<BinaryContinent> continentTable;
+    std::vector<BinaryTerritory> territoryTable;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> targets;
+    readTable(continentTable, header.numContinents);
+    readTable(territoryTable, header.numTerritories);
+    readTable(offsets, header.numTerritories + size_t{1});
+    readTable(targets, header.numAdjacency);
+    std::string_view strings(cursor, header.stringTableSize);
+
+    auto nameAt = [&strings](uint32_t offset, uint32_t length) -> std::optional<std::string_view>
+    {
+        if (uint64_t{offset} + length > strings.size())
+            return std::nullopt;
+        return strings.substr(offset, length);
+    };
+
+    auto *map = new Map();
+    map->reserve(continentTable.size(), territoryTable.size());
+    map->setIsValid(header.isValid != 0);
+    auto fail = [&]() -> Map *
+    {
+        std::cerr << "Error: The binary map file \"" << binaryPath << "\" is truncated or corrupted!\n";
+        delete map;
+        return nullptr;
+    };
+
+    for (const BinaryContinent &entry : continentTable)
+    {
+        auto name = nameAt(entry.nameOffset, entry.nameLength);
+        if (!name)
+            return fail();
+        map->addContinent(new Continent(std::string(*name), entry.bonus));
+    }
+
+    const auto &continents = map->getContinents();
+    for (const BinaryTerritory &entry : territoryTable)
+    {
+        auto name = nameAt(entry.nameOffset, entry.nameLength);
+        Continent *continent = entry.continent < continents.size() ? continents[entry.continent] : nullptr;
+        if (!name)
+            return fail();
+
+        auto *territory = new Territory(std::string(*name), entry.x, entry.y, continent);
+        if (continent)
+            continent->addTerritory(territory);
+        map->addTerritory(territory);
+    }
+
+    // Translate the CSR adjacency from territory ids to territory pointers
+    const auto &territories = map->getTerritories();
+    std::vector<size_t> adjacencyOffsets(offsets.begin(), offsets.end());
+    std::vector<Territory *> neighbours;
+    neighbours.reserve(targets.size());
+    for (size_t i = 0; i < territoryTable.size(); ++i)
+    {
+        if (offsets[i] > offsets[i + 1])
+            return fail();
+    }
+    if (offsets.front() != 0 || offsets.back() != targets.size())
+        return fail();
+    for (uint32_t target : targets)
+    {
+        if (target >= territories.size())
+            return fail();
+        neighbours.push_back(territories[target]);
+    }
+    map->setAdjacency(std::move(adjacencyOffsets), std::move(neighbours));
+
+    gameOut() << "Loaded " << map->getNumContinents() << " continents.\n";
+    gameOut() << "Loaded " << map->getNumTerritories() << " territories.\n\n";
+
+    return map;
+}
+
+std::string MapLoader::binaryPathFor(const std::string &mapPath)
+{
+    return mapPath + ".bin";
+}
+
+bool MapLoader::isBinaryUpToDate(const std::string &mapPath, const std::string &binaryPath)
+{
+    std::error_code error;
+    auto binaryTime = std::filesystem::last_write_time(binaryPath, error);
+    if (error)
+        return false;
+
+    auto mapTime = std::filesystem::last_write_time(mapPath, error);
+    return !error && binaryTime >= mapTime;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool MapLoader::parse(std::string_view contents, Map &map)
+{
     ParseState state = ParseState::NONE;
 
     // Flags to check presence of [Continents] and [Territories]
     bool hasContinents = false, hasTerritories = false;
 
+    adjacencyNames.clear();
+    adjacencyNameOffsets.assign(1, 0);
+
     // Read each line of the file
-    while (getline(file, line))
+    while (!contents.empty())
     {
-
         // Remove any whitespace from the start/end of the line
-        line = trim(line);
+        std::string_view line = trim(nextToken(contents, '\n'));
 
         // Detect "Continents" section
-        if (line.find("[Continents]") != std::string::npos)
+        if (line.find("[Continents]") != std::string_view::npos)
         {
             state = ParseState::CONTINENTS;
             hasContinents = true;
@@ -554,7 +1188,7 @@ Map *MapLoader::load()
 
             // Detect "Territories" section
         }
-        else if (line.find("[Territories]") != std::string::npos)
+        else if (line.find("[Territories]") != std::string_view::npos)
         {
             state = ParseState::TERRITORIES;
             hasTerritories = true;
@@ -564,10 +1198,10 @@ Map *MapLoader::load()
         switch (state)
         {
         case ParseState::CONTINENTS:
-            parseContinentLine(line, *map);
+            parseContinentLine(line, map);
             break;
         case ParseState::TERRITORIES:
-            parseTerritoryLine(line, *map);
+            parseTerritoryLine(line, map);
             break;
         default:
             // Either the line is part of an unrecognized section or it's an error. For now skip it.
@@ -576,102 +1210,243 @@ Map *MapLoader::load()
     }
 
     // Check if map file is missing [Continents] and/or [Territories] sections
-    if (!hasContinents || !hasTerritories)
+    if (!hasContinents)
+    {
+        std::cerr << "Error: The map file \"" << filePath << "\" does not have a [Continents] section.\n";
+    }
+    if (!hasTerritories)
     {
-        (*map).setIsValid(false);
-        if (!hasContinents)
+        std::cerr << "Error: The map file \"" << filePath << "\" does not have a [Territories] section.\n";
+    }
+    return hasContinents && hasTerritories;
+}
+
+bool MapLoader::parseParallel(std::string_view contents, Map &map, ThreadPool &pool)
+{
+    ParseState state = ParseState::NONE;
+
+    // Flags to check presence of [Continents] and [Territories]
+    bool hasContinents = false, hasTerritories = false;
+
+    adjacencyNames.clear();
+    adjacencyNameOffsets.assign(1, 0);
+
+    // Parses the body of a section, in the state it was opened in
+    auto parseSection = [&](std::string_view body) {
+        switch (state)
         {
-            std::cerr << "Error: The map file \"" << filePath << "\" does not have a [Continents] section.\n";
+        case ParseState::CONTINENTS:
+            while (!body.empty())
+            {
+                parseContinentLine(trim(nextToken(body, '\n')), map);
+            }
+            break;
+        case ParseState::TERRITORIES:
+            parseTerritorySection(body, map, pool);
+            break;
+        default:
+            break;
         }
-        if (!hasTerritories)
+    };
+
+    // Section headers are the only lines that need to be found up front, and only lines holding a '[' can be one
+    size_t bodyStart = 0;
+    size_t position = 0;
+    while ((position = contents.find('[', position)) != std::string_view::npos)
+    {
+        size_t lineStart = contents.rfind('\n', position);
+        lineStart = lineStart == std::string_view::npos ? 0 : lineStart + 1;
+        size_t lineEnd = std::min(contents.find('\n', position), contents.size());
+        std::string_view line = contents.substr(lineStart, lineEnd - lineStart);
+
+        ParseState nextState;
+        if (line.find("[Continents]") != std::string_view::npos)
         {
-            std::cerr << "Error: The map file \"" << filePath << "\" does not have a [Territories] section.\n";
+            nextState = ParseState::CONTINENTS;
+            hasContinents = true;
         }
-        delete map;
-        return nullptr;
+        else if (line.find("[Territories]") != std::string_view::npos)
+        {
+            nextState = ParseState::TERRITORIES;
+            hasTerritories = true;
+        }
+        else
+        {
+            position = lineEnd;
+            continue;
+        }
+
+        parseSection(contents.substr(bodyStart, lineStart - bodyStart));
+        state = nextState;
+        bodyStart = std::min(lineEnd + 1, contents.size());
+        position = bodyStart;
     }
+    parseSection(contents.substr(bodyStart));
 
-    // Once loaded all the territories, link them to their adjacent territories.
-    linkAdjacentTerritories(*map);
+    // Check if map file is missing [Continents] and/or [Territories] sections
+    if (!hasContinents)
+    {
+        std::cerr << "Error: The map file \"" << filePath << "\" does not have a [Continents] section.\n";
+    }
+    if (!hasTerritories)
+    {
+        std::cerr << "Error: The map file \"" << filePath << "\" does not have a [Territories] section.\n";
+    }
+    return hasContinents && hasTerritories;
+}
 
-    file.close();
+void MapLoader::parseTerritorySection(std::string_view section, Map &map, ThreadPool &pool)
+{
+    // Split the section into a few chunks per thread, each ending on a line boundary
+    std::vector<std::string_view> chunks;
+    const size_t numChunks = pool.size() * 4;
+    const size_t targetSize = section.size() / numChunks + 1;
+    while (!section.empty())
+    {
+        size_t end = section.find('\n', std::min(targetSize, section.size() - 1));
+        end = end == std::string_view::npos ? section.size() : end + 1;
+        chunks.push_back(section.substr(0, end));
+        section.remove_prefix(end);
+    }
 
-    std::cout << "Loaded " << (*map).getNumContinents() << " continents.\n";
-    std::cout << "Loaded " << (*map).getNumTerritories() << " territories.\n\n";
+    // Parse the chunks concurrently. Continents are only looked up, so the map is not modified until the merge
+    std::vector<TerritoryChunk> results(chunks.size());
+    std::vector<std::future<void>> tasks;
+    tasks.reserve(chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i)
+    {
+        tasks.push_back(pool.submit([&map, &chunks, &results, i]() {
+            std::string_view chunk = chunks[i];
+            TerritoryChunk &result = results[i];
+            while (!chunk.empty())
+            {
+                Territory *territory = parseTerritoryRecord(trim(nextToken(chunk, '\n')), map, result.errors,
+                                                            result.adjacencyNames);
+                if (territory)
+                {
+                    result.territories.push_back(territory);
+                    result.adjacencyOffsets.push_back(result.adjacencyNames.size());
+                }
+            }
+        }));
+    }
+    for (auto &task : tasks)
+    {
+        task.get();
+    }
 
-    return map;
+    // Merge the chunks in file order, so that territory ids and error output match a sequential parse
+    size_t numTerritories = map.getNumTerritories();
+    size_t numNames = adjacencyNames.size();
+    for (const TerritoryChunk &result : results)
+    {
+        numTerritories += result.territories.size();
+        numNames += result.adjacencyNames.size();
+    }
+    map.reserve(map.getNumContinents(), numTerritories);
+    adjacencyNames.reserve(numNames);
+    adjacencyNameOffsets.reserve(numTerritories + 1);
+
+    for (const TerritoryChunk &result : results)
+    {
+        std::cerr << result.errors.view();
+        for (size_t i = 0; i < result.territories.size(); ++i)
+        {
+            Territory *territory = result.territories[i];
+            territory->getContinent()->addTerritory(territory);
+            map.addTerritory(territory);
+
+            adjacencyNames.insert(adjacencyNames.end(),
+                                  result.adjacencyNames.begin() + static_cast<std::ptrdiff_t>(result.adjacencyOffsets[i]),
+                                  result.adjacencyNames.begin() + static_cast<std::ptrdiff_t>(result.adjacencyOffsets[i + 1]));
+            adjacencyNameOffsets.push_back(adjacencyNames.size());
+        }
+    }
 }
 
-void MapLoader::parseContinentLine(const std::string &line, Map &map)
+void MapLoader::parseContinentLine(std::string_view line, Map &map)
 {
-    if (line.empty() || line.find('=') == std::string::npos)
+    if (line.empty() || line.find('=') == std::string_view::npos)
     {
         return;
     }
 
-    std::stringstream ss(line);
-    std::string continentName, bonusStr;
-    getline(ss, continentName, '=');
-    getline(ss, bonusStr, '=');
+    std::string_view continentName = nextToken(line, '=');
+    std::string_view bonusStr = nextToken(line, '=');
+
+    int bonusValue;
+    if (!parseInt(bonusStr, bonusValue))
+    {
+        std::cerr << "Error: continent \"" << continentName << "\" has an invalid bonus value \"" << bonusStr << "\"!\n";
+        return;
+    }
 
-    int bonusValue = stoi(bonusStr);
-    Continent *newContinent = new Continent(continentName, bonusValue);
+    Continent *newContinent = new Continent(std::string(continentName), bonusValue);
     map.addContinent(newContinent);
 }
 
-void MapLoader::parseTerritoryLine(const std::string &line, Map &map)
+void MapLoader::parseTerritoryLine(std::string_view line, Map &map)
 {
+    Territory *newTerritory = parseTerritoryRecord(line, map, std::cerr, adjacencyNames);
+    if (!newTerritory)
+    {
+        return;
+    }
+
+    newTerritory->getContinent()->addTerritory(newTerritory);
+    map.addTerritory(newTerritory);
+    adjacencyNameOffsets.push_back(adjacencyNames.size());
+}
 
-    std::stringstream ss(line);
-    std::string territoryName, xStr, yStr, continentName, adjacentTerritory;
+Territory *MapLoader::parseTerritoryRecord(std::string_view line, const Map &map, std::ostream &errors,
+                                           std::vector<std::string_view> &adjacencyNames)
+{
+    if (line.empty())
+    {
+        return nullptr;
+    }
 
-    getline(ss, territoryName, ',');
-    getline(ss, xStr, ',');
-    getline(ss, yStr, ',');
-    getline(ss, continentName, ',');
+    std::string_view territoryName = nextToken(line, ',');
+    std::string_view xStr = nextToken(line, ',');
+    std::string_view yStr = nextToken(line, ',');
+    std::string_view continentName = nextToken(line, ',');
 
     Continent *continentPtr = map.getContinentByName(continentName);
 
     // Check if continent exists
     if (!continentPtr)
     {
-        std::cerr
+        errors
             << "Error: territory \"" << territoryName
             << "\" is associated with continent \"" << continentName
             << "\" but \"" << continentName << "\" does not exist!\n";
-        return;
+        return nullptr;
     }
 
-    Territory *newTerritory = new Territory(territoryName, stoi(xStr), stoi(yStr), continentPtr);
-
-    continentPtr->addTerritory(newTerritory);
-    map.addTerritory(newTerritory);
-
-    std::vector<std::string> adjacentNames;
-
-    getline(ss, adjacentTerritory, ',');
-    if (adjacentTerritory.empty())
+    int x, y;
+    if (!parseInt(xStr, x) || !parseInt(yStr, y))
     {
-        std::cerr << "Error: territory \"" << territoryName << "\" has no adjacent territories!\n";
+        errors << "Error: territory \"" << territoryName << "\" has invalid coordinates!\n";
+        return nullptr;
     }
-    else
+
+    // The territory name is only materialised here, once
+    Territory *newTerritory = new Territory(std::string(territoryName), x, y, continentPtr);
+
+    // Store the adjacent territory names, as views into the file contents
+    if (line.empty() || line.front() == ',')
     {
-        adjacentNames.push_back(trim(adjacentTerritory));
+        errors << "Error: territory \"" << territoryName << "\" has no adjacent territories!\n";
     }
 
-    while (ss.good())
+    while (!line.empty())
     {
-        getline(ss, adjacentTerritory, ',');
+        std::string_view adjacentTerritory = trim(nextToken(line, ','));
         if (!adjacentTerritory.empty())
         {
-            adjacentNames.push_back(trim(adjacentTerritory));
+            adjacencyNames.push_back(adjacentTerritory);
         }
     }
-
-    // Store the adjacent territory
-    parsedTerritoryAdjacencies[territoryName] = adjacentNames;
+    return newTerritory;
 }
 
-std::vector<Territory *> Map::getTerritories() const {
-    return territories;
-}
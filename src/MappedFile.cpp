@@ -0,0 +1,143 @@
+#include <utility>
+
+#include "../headers/MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string &filePath)
+{
+    open(filePath);
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : begin(std::exchange(other.begin, nullptr)), length(std::exchange(other.length, 0)),
+      opened(std::exchange(other.opened, false))
+{
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        begin = std::exchange(other.begin, nullptr);
+        length = std::exchange(other.length, 0);
+        opened = std::exchange(other.opened, false);
+    }
+    return *this;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::string &filePath)
+{
+    close();
+
+    HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    //  Zero-length files cannot be mapped, but are still successfully 'opened'
+    if (fileSize.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            CloseHandle(file);
+            return false;
+        }
+        begin = static_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        CloseHandle(mapping);
+        if (begin == nullptr)
+        {
+            CloseHandle(file);
+            return false;
+        }
+    }
+
+    CloseHandle(file);
+    length = static_cast<size_t>(fileSize.QuadPart);
+    opened = true;
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (begin != nullptr)
+        UnmapViewOfFile(begin);
+
+    begin = nullptr;
+    length = 0;
+    opened = false;
+}
+
+#else
+
+bool MappedFile::open(const std::string &filePath)
+{
+    close();
+
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat fileStat{};
+    if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    //  Zero-length files cannot be mapped, but are still successfully 'opened'
+    if (fileStat.st_size > 0)
+    {
+        void *address = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            ::close(fd);
+            return false;
+        }
+        //  The file is scanned front to back exactly once
+        madvise(address, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+        begin = static_cast<const char *>(address);
+    }
+
+    //  The mapping stays valid after the descriptor is closed
+    ::close(fd);
+    length = static_cast<size_t>(fileStat.st_size);
+    opened = true;
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (begin != nullptr)
+        munmap(const_cast<char *>(begin), length);
+
+    begin = nullptr;
+    length = 0;
+    opened = false;
+}
+
+#endif
@@ -1,31 +1,173 @@
 #include <iostream>
 #include <algorithm>
+#include <type_traits>
 
 #include "../headers/Orders.h"
 #include "../headers/Map.h"
 #include "../headers/player/Player.h"
 #include "../headers/Cards.h"
+#include "../headers/Random.h"
+#include "../headers/Combat.h"
+#include "../headers/gameengine/GameOutput.h"
+
+//  Describes an executed order for the binary event log: its type, owner and target. Orders moving armies add their
+//  own details
+static LogEntry orderLogEntry(Order::OrderType type, Player *owner, Territory *target)
+{
+    LogEntry entry;
+    entry.kind = LogEventKind::OrderExecuted;
+    entry.orderType = static_cast<int>(type);
+    entry.player = owner;
+    entry.target = target;
+    entry.value = target != nullptr ? target->getNumberOfArmies() : 0;
+    return entry;
+}
+
+//  Prints the type and target territory of an order
+static ostream &printOrderSummary(ostream &outs, Order::OrderType type, const Territory *target)
+{
+    if (target)
+    {
+        return outs << "Order: type = " << Order::orderTypeToString(type) << ", target = " << target->getName();
+    }
+    else
+    {
+        return outs << "Order: type = " << Order::orderTypeToString(type) << ", target = NULL";
+    }
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 //  ORDERS LIST
+
+namespace
+{
+    //  Whether an alternative of a stored order is an Order object, rather than the values of an order
+    template <typename Entry>
+    constexpr bool isOrderObject = std::is_same_v<std::decay_t<Entry>, Order *>;
+
+    /**
+     * \brief   Event notified to the observers of an orders list when one of its inline orders is executed. It logs
+     *          the same as the Order object of the order would
+     */
+    template <typename Action>
+    class ExecutedOrderEvent : public ILoggable
+    {
+    public:
+        ExecutedOrderEvent(const Action &action, Player *owner) : action(action), owner(owner) {}
+
+        string stringToLog() override { return action.describe(); }
+
+        LogEntry toLogEntry() override { return action.toLogEntry(owner); }
+
+    private:
+        const Action &action;
+        Player *owner;
+    };
+
+    //  Executes an order stored inline, reporting it as its Order object would
+    template <typename Action>
+    void executeOrder(const Action &action, Player *owner, OrdersList &ordersList)
+    {
+        if (!action.validate(owner))
+        {
+            if (!isGameOutputQuiet())
+                gameOut() << action << " is an invalid order. No action is executed" << endl;
+            return;
+        }
+
+        action.apply(owner);
+        if (!isGameOutputQuiet())
+            gameOut() << action << " has been executed." << endl;
+        ExecutedOrderEvent<Action> event(action, owner);
+        ordersList.notify(&event);
+    }
+
+    //  Executes an order added to the list as an Order object
+    void executeOrder(Order *order, Player *, OrdersList &)
+    {
+        order->execute();
+        delete order;
+    }
+
+    //  Returns the stored order holding the given Order object
+    RingBuffer<CompactOrder>::iterator findOrder(RingBuffer<CompactOrder> &orders, const Order *order)
+    {
+        return std::find_if(orders.begin(), orders.end(), [order](const CompactOrder &entry)
+        {
+            auto *boxed = std::get_if<Order *>(&entry);
+            return boxed != nullptr && *boxed == order;
+        });
+    }
+
+    //  Returns a copy of a stored order: Order objects are copied as values
+    CompactOrder copyOrder(const CompactOrder &order)
+    {
+        if (const auto *boxed = std::get_if<Order *>(&order))
+            return (*boxed)->compact();
+        return order;
+    }
+}
+
+Order::OrderType orderTypeOf(const CompactOrder &order)
+{
+    return std::visit([](const auto &entry)
+    {
+        if constexpr (isOrderObject<decltype(entry)>)
+            return entry->getOrderType();
+        else
+            return std::decay_t<decltype(entry)>::type;
+    }, order);
+}
+
 OrdersList::OrdersList(Player *owner)
 {
     OrdersList::owner = owner;
 }
 
 OrdersList::OrdersList(OrdersList &ordersList)
+    : OrdersList(ordersList, ordersList.owner)
 {
-    orders = ordersList.orders;
-    owner = ordersList.owner;
+}
+
+OrdersList::OrdersList(const OrdersList &ordersList, Player *owner)
+{
+    for (const CompactOrder &order : ordersList.orders)
+        orders.push_back(copyOrder(order));
+    OrdersList::owner = owner;
+}
+
+OrdersList::~OrdersList()
+{
+    for (CompactOrder &order : orders)
+    {
+        if (auto *boxed = std::get_if<Order *>(&order))
+            delete *boxed;
+    }
+}
+
+Order *OrdersList::box(CompactOrder &order)
+{
+    if (auto *boxed = std::get_if<Order *>(&order))
+        return *boxed;
+
+    Order *boxed = std::visit([this](const auto &action) -> Order *
+    {
+        if constexpr (isOrderObject<decltype(action)>)
+            return action;
+        else
+            return action.toOrder(owner);
+    }, order);
+    attachObserversTo(*boxed);
+    order = boxed;
+    ordersBoxed++;
+    return boxed;
 }
 
 Order *OrdersList::operator[](size_t index)
 {
     if (index < orders.size())
     {
-        auto iterator = orders.begin();
-        std::advance(iterator, index);
-        return *iterator;
+        return box(orders[index]);
     }
 
     return nullptr;
@@ -35,9 +177,17 @@ OrdersList &OrdersList::operator=(const OrdersList &ordersList)
 {
     if (this == &ordersList)
     {
+        return *this;
     }
 
-    orders = ordersList.orders;
+    for (CompactOrder &order : orders)
+    {
+        if (auto *boxed = std::get_if<Order *>(&order))
+            delete *boxed;
+    }
+    orders.clear();
+    for (const CompactOrder &order : ordersList.orders)
+        orders.push_back(copyOrder(order));
     owner = ordersList.owner;
     return *this;
 }
@@ -45,10 +195,18 @@ OrdersList &OrdersList::operator=(const OrdersList &ordersList)
 ostream &operator<<(ostream &outs, const OrdersList &ordersList)
 {
     outs << "{\n";
-    list<Order *>::const_iterator itr;
-    for (itr = ordersList.orders.begin(); itr != ordersList.orders.end(); ++itr)
+    for (const CompactOrder &order : ordersList.orders)
     {
-        outs << *(*itr) << ";" << endl;
+        std::visit([&outs](const auto &entry)
+        {
+            if constexpr (isOrderObject<decltype(entry)>)
+                outs << *entry;
+            else if constexpr (std::is_same_v<std::decay_t<decltype(entry)>, NegotiateAction>)
+                printOrderSummary(outs, entry.type, nullptr);
+            else
+                printOrderSummary(outs, entry.type, entry.target);
+        }, order);
+        outs << ";" << endl;
     }
     outs << "}";
     return outs;
@@ -59,6 +217,8 @@ bool OrdersList::addOrder(Order *order)
     if (order != nullptr)
     {
         orders.push_back(order);
+        //  The order reports its execution to whoever watches the list
+        attachObserversTo(*order);
         notify(this);
         return true;
     }
@@ -66,6 +226,16 @@ bool OrdersList::addOrder(Order *order)
     return false;
 }
 
+bool OrdersList::addOrder(const CompactOrder &order)
+{
+    if (const auto *boxed = std::get_if<Order *>(&order))
+        return addOrder(*boxed);
+
+    orders.push_back(order);
+    notify(this);
+    return true;
+}
+
 const Player *OrdersList::getOwner() const
 {
     return this->owner;
@@ -73,65 +243,107 @@ const Player *OrdersList::getOwner() const
 
 Order *OrdersList::getNextOrder()
 {
-    auto *nextOrder = !orders.empty() ? orders.front() : nullptr;
-    if (!orders.empty())
+    if (orders.empty())
     {
-        orders.pop_front();
+        return nullptr;
     }
+
+    auto *nextOrder = box(orders.front());
+    orders.pop_front();
     return nextOrder;
 }
 
+bool OrdersList::executeNextOrder()
+{
+    if (orders.empty())
+    {
+        return false;
+    }
+
+    CompactOrder nextOrder = orders.front();
+    orders.pop_front();
+    std::visit([this](const auto &entry)
+    { executeOrder(entry, owner, *this); }, nextOrder);
+    return true;
+}
+
+Order::OrderType OrdersList::nextOrderType() const
+{
+    return orderTypeOf(orders.front());
+}
+
+size_t OrdersList::moveDeployOrdersFirst()
+{
+    return orders.stablePartition([](const CompactOrder &order)
+    { return orderTypeOf(order) == Order::OrderType::Deploy; });
+}
+
 void OrdersList::apply(void (*func)(Order *))
 {
-    for (auto *order : orders)
+    for (CompactOrder &order : orders)
     {
-        if (order != nullptr)
-        {
-            func(order);
-        }
+        func(box(order));
     }
 }
 
 void OrdersList::remove(Order *order)
 {
-    auto it = std::find(orders.begin(), orders.end(), order);
-    if (it == orders.end())
+    auto it = findOrder(orders, order);
+    if (order == nullptr || it == orders.end())
     {
-        cout << "(OrdersList::remove())Order not found in the list." << endl;
+        gameOut() << "(OrdersList::remove())Order not found in the list." << endl;
         return;
     }
 
-    orders.remove(order);
+    orders.erase(it.position());
     delete order;
 
-    cout << "OrdersList::remove() was successful.\n";
+    gameOut() << "OrdersList::remove() was successful.\n";
 }
 
 bool OrdersList::move(Order *order, int index)
 {
     if (index < 0 || index >= orders.size())
     {
-        cout << "(OrdersList::move())Specified index is wrong." << endl;
+        gameOut() << "(OrdersList::move())Specified index is wrong." << endl;
         return false;
     }
-    auto it = std::find(orders.begin(), orders.end(), order);
-    if (it == orders.end())
+    auto it = findOrder(orders, order);
+    if (order == nullptr || it == orders.end())
     {
-        cout << "(OrdersList::move())Order not found in the list." << endl;
+        gameOut() << "(OrdersList::move())Order not found in the list." << endl;
         return false;
     }
 
-    orders.remove(order);
-    it = orders.begin();
-    advance(it, index);
-    orders.insert(it, order);
-    cout << "OrdersList::move() was successful.\n";
+    orders.moveTo(it.position(), index);
+    gameOut() << "OrdersList::move() was successful.\n";
+    return true;
+}
+
+bool OrdersList::reorder(size_t from, size_t to)
+{
+    if (from >= orders.size() || to >= orders.size())
+    {
+        gameOut() << "(OrdersList::reorder())Specified index is wrong." << endl;
+        return false;
+    }
+
+    orders.moveTo(from, to);
     return true;
 }
 
 string OrdersList::stringToLog()
 {
-    return "New Order added: " + Order::orderTypeToString(orders.back()->getOrderType());
+    return "New Order added: " + Order::orderTypeToString(orderTypeOf(orders.back()));
+}
+
+LogEntry OrdersList::toLogEntry()
+{
+    LogEntry entry;
+    entry.kind = LogEventKind::OrderIssued;
+    entry.orderType = static_cast<int>(orderTypeOf(orders.back()));
+    entry.player = owner;
+    return entry;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -220,6 +432,11 @@ Order::OrderType Order::getOrderType()
     return this->type;
 }
 
+LogEntry Order::toLogEntry()
+{
+    return orderLogEntry(type, owner, target);
+}
+
 Order &Order::operator=(const Order &order)
 {
     if (this != &order)
@@ -234,14 +451,7 @@ Order &Order::operator=(const Order &order)
 
 ostream &operator<<(ostream &outs, const Order &order)
 {
-    if (order.target)
-    {
-        return outs << "Order: type = " << Order::orderTypeToString(order.type) << ", target = " << order.target->getName();
-    }
-    else
-    {
-        return outs << "Order: type = " << Order::orderTypeToString(order.type) << ", target = NULL";
-    }
+    return printOrderSummary(outs, order.type, order.target);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -275,15 +485,52 @@ DeployOrder &DeployOrder::operator=(const DeployOrder &order)
     return *this;
 }
 
+DeployAction DeployOrder::action() const
+{
+    return {target, armyUnits};
+}
+
+CompactOrder DeployOrder::compact() const
+{
+    return action();
+}
+
 string DeployOrder::stringToLog()
 {
-    return "Order: type = " + Order::orderTypeToString(this->type) + ", target = " + this->target->getName() + ", army units = " + std::to_string(this->armyUnits);
+    return action().describe();
+}
+
+LogEntry DeployOrder::toLogEntry()
+{
+    return action().toLogEntry(owner);
 }
 
 ostream &operator<<(ostream &outs, const DeployOrder &order)
 {
-    return outs << "DeployOrder: type = " << Order::orderTypeToString(order.type) << ", target = " << order.target->getName()
-                << ", army units = " << order.armyUnits;
+    return outs << order.action();
+}
+
+Order *DeployAction::toOrder(Player *owner) const
+{
+    return new DeployOrder(owner, target, armyUnits);
+}
+
+string DeployAction::describe() const
+{
+    return "Order: type = " + Order::orderTypeToString(type) + ", target = " + target->getName() + ", army units = " + std::to_string(armyUnits);
+}
+
+LogEntry DeployAction::toLogEntry(Player *owner) const
+{
+    LogEntry entry = orderLogEntry(type, owner, target);
+    entry.armies = armyUnits;
+    return entry;
+}
+
+ostream &operator<<(ostream &outs, const DeployAction &action)
+{
+    return outs << "DeployOrder: type = " << Order::orderTypeToString(action.type) << ", target = " << action.target->getName()
+                << ", army units = " << action.armyUnits;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -316,15 +563,53 @@ AdvanceOrder &AdvanceOrder::operator=(const AdvanceOrder &order)
     return *this;
 }
 
+AdvanceAction AdvanceOrder::action() const
+{
+    return {target, source, armyUnits};
+}
+
+CompactOrder AdvanceOrder::compact() const
+{
+    return action();
+}
+
 string AdvanceOrder::stringToLog()
 {
-    return "Order: type = " + Order::orderTypeToString(this->type) + ", target = " + this->target->getName() + ", army units = " + std::to_string(this->armyUnits) + ", source = " + this->source->getName();
+    return action().describe();
+}
+
+LogEntry AdvanceOrder::toLogEntry()
+{
+    return action().toLogEntry(owner);
 }
 
 ostream &operator<<(ostream &outs, const AdvanceOrder &order)
 {
-    return outs << "AdvanceOrder: type = " << Order::orderTypeToString(order.type) << ", target = " << order.target->getName()
-                << ", army units = " << order.armyUnits << ", source = " << order.source->getName();
+    return outs << order.action();
+}
+
+Order *AdvanceAction::toOrder(Player *owner) const
+{
+    return new AdvanceOrder(owner, target, armyUnits, source);
+}
+
+string AdvanceAction::describe() const
+{
+    return "Order: type = " + Order::orderTypeToString(type) + ", target = " + target->getName() + ", army units = " + std::to_string(armyUnits) + ", source = " + source->getName();
+}
+
+LogEntry AdvanceAction::toLogEntry(Player *owner) const
+{
+    LogEntry entry = orderLogEntry(type, owner, target);
+    entry.source = source;
+    entry.armies = armyUnits;
+    return entry;
+}
+
+ostream &operator<<(ostream &outs, const AdvanceAction &action)
+{
+    return outs << "AdvanceOrder: type = " << Order::orderTypeToString(action.type) << ", target = " << action.target->getName()
+                << ", army units = " << action.armyUnits << ", source = " << action.source->getName();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -353,14 +638,44 @@ BombOrder &BombOrder::operator=(const BombOrder &order)
     return *this;
 }
 
+BombAction BombOrder::action() const
+{
+    return {target};
+}
+
+CompactOrder BombOrder::compact() const
+{
+    return action();
+}
+
 string BombOrder::stringToLog()
 {
-    return "Order: type = " + Order::orderTypeToString(this->type) + ", target = " + this->target->getName();
+    return action().describe();
 }
 
 ostream &operator<<(ostream &outs, const BombOrder &order)
 {
-    return outs << "BombOrder: type = " << Order::orderTypeToString(order.type) << ", target = " << order.target->getName();
+    return outs << order.action();
+}
+
+Order *BombAction::toOrder(Player *owner) const
+{
+    return new BombOrder(owner, target);
+}
+
+string BombAction::describe() const
+{
+    return "Order: type = " + Order::orderTypeToString(type) + ", target = " + target->getName();
+}
+
+LogEntry BombAction::toLogEntry(Player *owner) const
+{
+    return orderLogEntry(type, owner, target);
+}
+
+ostream &operator<<(ostream &outs, const BombAction &action)
+{
+    return outs << "BombOrder: type = " << Order::orderTypeToString(action.type) << ", target = " << action.target->getName();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -389,14 +704,44 @@ BlockadeOrder &BlockadeOrder::operator=(const BlockadeOrder &order)
     return *this;
 }
 
+BlockadeAction BlockadeOrder::action() const
+{
+    return {target};
+}
+
+CompactOrder BlockadeOrder::compact() const
+{
+    return action();
+}
+
 string BlockadeOrder::stringToLog()
 {
-    return "Order: type = " + Order::orderTypeToString(this->type) + ", target = " + this->target->getName();
+    return action().describe();
 }
 
 ostream &operator<<(ostream &outs, const BlockadeOrder &order)
 {
-    return outs << "BlockadeOrder: type = " << Order::orderTypeToString(order.type) << ", target = " << order.target->getName();
+    return outs << order.action();
+}
+
+Order *BlockadeAction::toOrder(Player *owner) const
+{
+    return new BlockadeOrder(owner, target);
+}
+
+string BlockadeAction::describe() const
+{
+    return "Order: type = " + Order::orderTypeToString(type) + ", target = " + target->getName();
+}
+
+LogEntry BlockadeAction::toLogEntry(Player *owner) const
+{
+    return orderLogEntry(type, owner, target);
+}
+
+ostream &operator<<(ostream &outs, const BlockadeAction &action)
+{
+    return outs << "BlockadeOrder: type = " << Order::orderTypeToString(action.type) << ", target = " << action.target->getName();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -429,15 +774,53 @@ AirliftOrder &AirliftOrder::operator=(const AirliftOrder &order)
     return *this;
 }
 
+AirliftAction AirliftOrder::action() const
+{
+    return {target, source, armyUnits};
+}
+
+CompactOrder AirliftOrder::compact() const
+{
+    return action();
+}
+
 string AirliftOrder::stringToLog()
 {
-    return "Order: type = " + Order::orderTypeToString(this->type) + ", target = " + this->target->getName() + ", army units = " + std::to_string(this->armyUnits) + ", source = " + this->source->getName();
+    return action().describe();
+}
+
+LogEntry AirliftOrder::toLogEntry()
+{
+    return action().toLogEntry(owner);
 }
 
 ostream &operator<<(ostream &outs, const AirliftOrder &order)
 {
-    return outs << "AirliftOrder: type = " << Order::orderTypeToString(order.type) << ", target = " << order.target->getName()
-                << ", army units = " << order.armyUnits << ", source = " << order.source->getName();
+    return outs << order.action();
+}
+
+Order *AirliftAction::toOrder(Player *owner) const
+{
+    return new AirliftOrder(owner, target, armyUnits, source);
+}
+
+string AirliftAction::describe() const
+{
+    return "Order: type = " + Order::orderTypeToString(type) + ", target = " + target->getName() + ", army units = " + std::to_string(armyUnits) + ", source = " + source->getName();
+}
+
+LogEntry AirliftAction::toLogEntry(Player *owner) const
+{
+    LogEntry entry = orderLogEntry(type, owner, target);
+    entry.source = source;
+    entry.armies = armyUnits;
+    return entry;
+}
+
+ostream &operator<<(ostream &outs, const AirliftAction &action)
+{
+    return outs << "AirliftOrder: type = " << Order::orderTypeToString(action.type) << ", target = " << action.target->getName()
+                << ", army units = " << action.armyUnits << ", source = " << action.source->getName();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -467,14 +850,51 @@ NegotiateOrder &NegotiateOrder::operator=(const NegotiateOrder &order)
     return *this;
 }
 
+NegotiateAction NegotiateOrder::action() const
+{
+    return {player};
+}
+
+CompactOrder NegotiateOrder::compact() const
+{
+    return action();
+}
+
 string NegotiateOrder::stringToLog()
 {
-    return "Order: type = " + Order::orderTypeToString(this->type) + ", target player = " + this->player->getName();
+    return action().describe();
+}
+
+LogEntry NegotiateOrder::toLogEntry()
+{
+    return action().toLogEntry(owner);
 }
 
 ostream &operator<<(ostream &outs, const NegotiateOrder &order)
 {
-    return outs << "NegotiateOrder: type = " << Order::orderTypeToString(order.type) << ", target player = " << order.player->getName();
+    return outs << order.action();
+}
+
+Order *NegotiateAction::toOrder(Player *owner) const
+{
+    return new NegotiateOrder(owner, player);
+}
+
+string NegotiateAction::describe() const
+{
+    return "Order: type = " + Order::orderTypeToString(type) + ", target player = " + player->getName();
+}
+
+LogEntry NegotiateAction::toLogEntry(Player *owner) const
+{
+    LogEntry entry = orderLogEntry(type, owner, nullptr);
+    entry.otherPlayer = player;
+    return entry;
+}
+
+ostream &operator<<(ostream &outs, const NegotiateAction &action)
+{
+    return outs << "NegotiateOrder: type = " << Order::orderTypeToString(action.type) << ", target player = " << action.player->getName();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -492,17 +912,47 @@ bool Order::validate()
     return type != Order::OrderType::Invalid && (target != nullptr);
 }
 
-/** \remarks A <code>DeployOrder</code> is valid when:
+bool DeployOrder::validate()
+{
+    return action().validate(owner);
+}
+
+bool AdvanceOrder::validate()
+{
+    return action().validate(owner);
+}
+
+bool BombOrder::validate()
+{
+    return action().validate(owner);
+}
+
+bool BlockadeOrder::validate()
+{
+    return action().validate(owner);
+}
+
+bool AirliftOrder::validate()
+{
+    return action().validate(owner);
+}
+
+bool NegotiateOrder::validate()
+{
+    return action().validate(owner);
+}
+
+/** \remarks A deploy order is valid when:
  *           <ul><li> A valid target is specified. Additionally, the target territory must be owned by he player
  *                    owning the order.
  *           </ul>
  */
-bool DeployOrder::validate()
+bool DeployAction::validate(Player *owner) const
 {
     return (target != nullptr) && owner->ownsTerritory(*target);
 }
 
-/** \remarks A <code>AdvanceOrder</code> is valid when:
+/** \remarks An advance order is valid when:
  *           <ul><li> A valid source and target territories are specified. This source territory does not need to be
  *                    owned by the player.
  *               <li> A valid number of army units are specified.
@@ -511,65 +961,134 @@ bool DeployOrder::validate()
  *               <li> The owner of the target territory must <b>NOT</b> be in negotiations with the current player.
  *           </ul>
  */
-bool AdvanceOrder::validate()
+bool AdvanceAction::validate(Player *owner) const
 {
     return (source != nullptr && target != nullptr) && (armyUnits > 0 && armyUnits <= source->numberOfArmies) //  TODO: probably a logical bug here
            && (owner->ownsTerritory(*source)) && (source->isTerritoryAdjacent(target)) && !(owner->isPlayerInNegotiations(*target->getOwner()));
 }
 
-/** \remarks A <code>BombOrder</code> is valid when:
+/** \remarks A bomb order is valid when:
  *           <ul><li> A valid target territory is specified. A player <b>CANNOT</b> bomb their own territory.
  *               <li> The target territory must be adjacent to the player's territories.
  *               <li> The owner of the target territory must <b>NOT</b> be in negotiations with the current player.
  *           </ul>
  */
-bool BombOrder::validate()
+bool BombAction::validate(Player *owner) const
 {
-    return (target != nullptr) && !(owner->ownsTerritory(*target)) && (owner->isTerritoryAdjacent(*target)) && !(owner->isPlayerInNegotiations(*target->getOwner()));
+    return (target != nullptr) && (owner->isEnemyNeighbour(*target)) && !(owner->isPlayerInNegotiations(*target->getOwner()));
 }
 
-/** \remarks A <code>BlockadeOrder</code> is valid when:
+/** \remarks A blockade order is valid when:
  *           <ul><li> A valid target territory is specified. A player <b>CAN ONLY</b> blockade their own territory.
+ *               <li> The player takes part in a game, whose neutral player takes the territory.
  *           </ul>
  */
-bool BlockadeOrder::validate()
+bool BlockadeAction::validate(Player *owner) const
 {
-    return (target != nullptr) && (owner->ownsTerritory(*target));
+    return (target != nullptr) && (owner->ownsTerritory(*target)) && (owner->getNeutralPlayer() != nullptr);
 }
 
-/** \remarks A <code>AirliftOrder</code> is valid when:
+/** \remarks An airlift order is valid when:
  *           <ul><li> Valid source and target territories are specified. The player <b>MUST OWN</b> these territories.
  *               <li> A valid number of army units are specified.
  *           </ul>
  */
-bool AirliftOrder::validate()
+bool AirliftAction::validate(Player *owner) const
 {
     return (source != nullptr && target != nullptr) && (source && armyUnits > 0 && armyUnits <= source->numberOfArmies) && (owner->ownsTerritory(*source)) && (owner->ownsTerritory(*target));
 }
 
-/** \remarks A <code>NegotiateOrder</code> is valid when:
+/** \remarks A negotiate order is valid when:
  *           <ul><li> A valid player is specified. A player cannot negotiate with themselves.
+ *               <li> The player is one of the same game.
  *           </ul>
  */
-bool NegotiateOrder::validate()
+bool NegotiateAction::validate(Player *owner) const
 {
-    return (player != nullptr) && (player != owner);
+    return (player != nullptr) && (player != owner) && owner->canNegotiateWith(*player);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 //  ORDER EXECUTES
+void DeployAction::apply(Player *) const
+{
+    target->setNumberOfArmies(target->getNumberOfArmies() + armyUnits);
+}
+
+bool AdvanceAction::apply(Player *owner) const
+{
+    if (source->getOwner() == target->getOwner())
+    {
+        source->setNumberOfArmies(source->getNumberOfArmies() - armyUnits);
+        target->setNumberOfArmies(target->getNumberOfArmies() + armyUnits);
+        return false;
+    }
+
+    if (NeutralPlayerStrategy *temp_ptr = dynamic_cast<NeutralPlayerStrategy *>(target->getOwner()->getPlayerStrategy()))
+    {
+        target->getOwner()->setPlayerStrategy(new AggressivePlayerStrategy(target->getOwner()));
+    }
+    //  Each attacking unit has a 60% chance of killing a defending unit, each defending unit 70% of killing an
+    //  attacking unit. The kills are sampled at once rather than rolled unit by unit
+    Random &random = owner->getRandom();
+    int defenderUnitsKilled = sampleKills(armyUnits, ATTACKER_KILL_PROBABILITY, random);
+    int attackerUnitsKilled = sampleKills(target->getNumberOfArmies(), DEFENDER_KILL_PROBABILITY, random);
+    if (defenderUnitsKilled >= target->getNumberOfArmies())
+    {
+        target->getOwner()->removeTerritory(*target); //  The owner of the target no longer owns the target territory
+        target->setOwner(owner);                      //  Set the owner to this player (player that owns the order)
+        owner->addTerritory(*target);
+        source->setNumberOfArmies(source->getNumberOfArmies() - armyUnits);
+        target->setNumberOfArmies(armyUnits > attackerUnitsKilled ? armyUnits - attackerUnitsKilled : 0);
+        owner->setDrawCard(true);
+        return true;
+    }
+
+    target->setNumberOfArmies(target->getNumberOfArmies() - defenderUnitsKilled);
+    source->setNumberOfArmies(armyUnits >= attackerUnitsKilled ? source->getNumberOfArmies() - attackerUnitsKilled : source->getNumberOfArmies() - armyUnits);
+    return false;
+}
+
+void BombAction::apply(Player *) const
+{
+    if (NeutralPlayerStrategy *temp_ptr = dynamic_cast<NeutralPlayerStrategy *>(target->getOwner()->getPlayerStrategy()))
+    {
+        target->getOwner()->setPlayerStrategy(new AggressivePlayerStrategy(target->getOwner()));
+    }
+    target->setNumberOfArmies(target->getNumberOfArmies() / 2);
+}
+
+void BlockadeAction::apply(Player *owner) const
+{
+    target->getOwner()->removeTerritory(*target); //  The owner of the target no longer owns the target territory
+    owner->getNeutralPlayer()->addTerritory(*target);
+    target->setOwner(owner->getNeutralPlayer());
+    target->setNumberOfArmies(target->getNumberOfArmies() * 2);
+}
+
+void AirliftAction::apply(Player *) const
+{
+    source->setNumberOfArmies(source->getNumberOfArmies() - armyUnits);
+    target->setNumberOfArmies(target->getNumberOfArmies() + armyUnits);
+}
+
+void NegotiateAction::apply(Player *owner) const
+{
+    owner->negotiateWith(*player);
+}
+
 string DeployOrder::execute()
 {
     if (validate())
     {
-        target->setNumberOfArmies(target->getNumberOfArmies() + armyUnits);
-        cout << *this << " has been executed." << endl;
+        action().apply(owner);
+        gameOut() << *this << " has been executed." << endl;
         notify(this);
         return to_string(armyUnits) + " units were added to " + target->getName() + ". It now has " + to_string(target->getNumberOfArmies()) + " units.";
     }
     else
     {
-        cout << *this << " is an invalid order. No action is executed" << endl;
+        gameOut() << *this << " is an invalid order. No action is executed" << endl;
         return "Invalid order.";
     }
 }
@@ -578,63 +1097,26 @@ string AdvanceOrder::execute()
 {
     if (validate())
     {
-        if (source->getOwner() == target->getOwner())
+        bool moving = source->getOwner() == target->getOwner();
+        bool captured = action().apply(owner);
+        gameOut() << *this << " has been executed." << endl;
+        notify(this);
+        if (moving)
         {
-            source->setNumberOfArmies(source->getNumberOfArmies() - armyUnits);
-            target->setNumberOfArmies(target->getNumberOfArmies() + armyUnits);
-            cout << *this << " has been executed." << endl;
-            notify(this);
             return to_string(armyUnits) + " units were moved from " + source->getName() + " to " + target->getName() + ".";
         }
+        else if (captured)
+        {
+            return owner->getName() + " has captured " + target->getName() + ". It is now occupied by " + to_string(target->getNumberOfArmies()) + " units.";
+        }
         else
         {
-            if (NeutralPlayerStrategy *temp_ptr = dynamic_cast<NeutralPlayerStrategy *>(target->getOwner()->getPlayerStrategy()))
-            {
-                target->getOwner()->setPlayerStrategy(new AggressivePlayerStrategy(target->getOwner()));
-            }
-            int defenderUnitsKilled = 0;
-            int attackerUnitsKilled = 0;
-            for (int i = 0; i < armyUnits; i++)
-            {
-                float random = (float)rand() / RAND_MAX;
-                if (random <= 0.6f)
-                {
-                    defenderUnitsKilled++;
-                }
-            }
-            for (int i = 0; i < target->getNumberOfArmies(); i++)
-            {
-                float random = (float)rand() / RAND_MAX;
-                if (random <= 0.7f)
-                {
-                    attackerUnitsKilled++;
-                }
-            }
-            if (defenderUnitsKilled >= target->getNumberOfArmies())
-            {
-                target->getOwner()->removeTerritory(*target); //  The owner of the target no longer owns the target territory
-                target->setOwner(owner);                      //  Set the owner to this player (player that owns the order)
-                owner->addTerritory(*target);
-                source->setNumberOfArmies(source->getNumberOfArmies() - armyUnits);
-                target->setNumberOfArmies(armyUnits > attackerUnitsKilled ? armyUnits - attackerUnitsKilled : 0);
-                owner->setDrawCard(true);
-                cout << *this << " has been executed." << endl;
-                notify(this);
-                return owner->getName() + " has captured " + target->getName() + ". It is now occupied by " + to_string(target->getNumberOfArmies()) + " units.";
-            }
-            else
-            {
-                target->setNumberOfArmies(target->getNumberOfArmies() - defenderUnitsKilled);
-                source->setNumberOfArmies(armyUnits >= attackerUnitsKilled ? source->getNumberOfArmies() - attackerUnitsKilled : source->getNumberOfArmies() - armyUnits);
-                cout << *this << " has been executed." << endl;
-                notify(this);
-                return "The attack resulted in " + source->getName() + " having " + to_string(source->getNumberOfArmies()) + "units and " + target->getName() + " having " + to_string(target->getNumberOfArmies()) + " units left.";
-            }
+            return "The attack resulted in " + source->getName() + " having " + to_string(source->getNumberOfArmies()) + "units and " + target->getName() + " having " + to_string(target->getNumberOfArmies()) + " units left.";
         }
     }
     else
     {
-        cout << *this << " is an invalid order. No action is executed" << endl;
+        gameOut() << *this << " is an invalid order. No action is executed" << endl;
         return "Invalid order.";
     }
 }
@@ -643,18 +1125,14 @@ string BombOrder::execute()
 {
     if (validate())
     {
-        if (NeutralPlayerStrategy *temp_ptr = dynamic_cast<NeutralPlayerStrategy *>(target->getOwner()->getPlayerStrategy()))
-        {
-            target->getOwner()->setPlayerStrategy(new AggressivePlayerStrategy(target->getOwner()));
-        }
-        target->setNumberOfArmies(target->getNumberOfArmies() / 2);
-        cout << *this << " has been executed." << endl;
+        action().apply(owner);
+        gameOut() << *this << " has been executed." << endl;
         notify(this);
         return target->getName() + " was bombed. It has" + to_string(target->getNumberOfArmies()) + " units left.";
     }
     else
     {
-        cout << *this << " is an invalid order. No action is executed" << endl;
+        gameOut() << *this << " is an invalid order. No action is executed" << endl;
         return "Invalid order.";
     }
 }
@@ -663,18 +1141,14 @@ string BlockadeOrder::execute()
 {
     if (validate())
     {
-        target->getOwner()->removeTerritory(*target); //  The owner of the target no longer owns the target territory
-        Player::neutralPlayer->addTerritory(*target);
-        target->setOwner(Player::neutralPlayer);
-        target->setNumberOfArmies(target->getNumberOfArmies() * 2);
-
-        cout << *this << " has been executed." << endl;
+        action().apply(owner);
+        gameOut() << *this << " has been executed." << endl;
         notify(this);
         return "Neutral player now owns " + target->getName() + " with " + to_string(target->getNumberOfArmies()) + " units on it.";
     }
     else
     {
-        cout << *this << " is an invalid order. No action is executed" << endl;
+        gameOut() << *this << " is an invalid order. No action is executed" << endl;
         return "Invalid order.";
     }
 }
@@ -683,15 +1157,14 @@ string AirliftOrder::execute()
 {
     if (validate())
     {
-        source->setNumberOfArmies(source->getNumberOfArmies() - armyUnits);
-        target->setNumberOfArmies(target->getNumberOfArmies() + armyUnits);
-        cout << *this << " has been executed." << endl;
+        action().apply(owner);
+        gameOut() << *this << " has been executed." << endl;
         notify(this);
         return to_string(armyUnits) + " units have been moved from " + source->getName() + " to " + target->getName() + ".";
     }
     else
     {
-        cout << *this << " is an invalid order. No action is executed" << endl;
+        gameOut() << *this << " is an invalid order. No action is executed" << endl;
         return "Invalid order.";
     }
 }
@@ -700,15 +1173,14 @@ string NegotiateOrder::execute()
 {
     if (validate())
     {
-        owner->negotiateWith(*player);
-        player->negotiateWith(*owner);
-        cout << *this << " has been executed." << endl;
+        action().apply(owner);
+        gameOut() << *this << " has been executed." << endl;
         notify(this);
         return owner->getName() + " and " + player->getName() + " are now negotiating.";
     }
     else
     {
-        cout << *this << " is an invalid order. No action is executed" << endl;
+        gameOut() << *this << " is an invalid order. No action is executed" << endl;
         return "Invalid order.";
     }
-}
\ No newline at end of file
+}
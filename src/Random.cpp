@@ -0,0 +1,34 @@
+#include <random>
+
+#include "../headers/Random.h"
+
+Random::Random(std::uint64_t seed)
+{
+    Random::seed(seed);
+}
+
+void Random::seed(std::uint64_t seed)
+{
+    //  The state is expanded from the seed with splitmix64, as recommended by the authors of xoshiro: it is never all
+    //  zeros, and nearby seeds give unrelated sequences
+    for (std::uint64_t &word : state)
+    {
+        seed += 0x9e3779b97f4a7c15;
+        std::uint64_t z = seed;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        word = z ^ (z >> 31);
+    }
+}
+
+std::uint64_t Random::randomSeed()
+{
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) ^ device();
+}
+
+Random &Random::threadDefault()
+{
+    static thread_local Random generator;
+    return generator;
+}
@@ -0,0 +1,49 @@
+#include "../headers/ThreadPool.h"
+
+ThreadPool::ThreadPool(unsigned numThreads)
+{
+    if (numThreads == 0)
+        numThreads = hardwareThreads();
+
+    workers.reserve(numThreads);
+    for (unsigned i = 0; i < numThreads; ++i)
+        workers.emplace_back(&ThreadPool::run, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    available.notify_all();
+
+    for (std::thread &worker : workers)
+        worker.join();
+}
+
+unsigned ThreadPool::hardwareThreads() noexcept
+{
+    unsigned count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+void ThreadPool::run()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+            //  Only stop once every queued task has been run
+            if (tasks.empty())
+                return;
+
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+    }
+}
@@ -13,6 +13,7 @@
 
 #include "../../headers/gameengine/GameEngine.h"
 #include "../../headers/gameengine/State.h"
+#include "../../headers/gameengine/GameOutput.h"
 #include "../../headers/commandprocessing/CommandProcessing.h"
 #include "../../headers/macros/DebugMacros.h"
 
@@ -35,11 +36,11 @@ void CommandProcessor::printErrorMenu(std::vector<std::string> helpStrings) {
     std::string AnsiRed = "\033[31m";
     std::string AnsiClear = "\033[0m";
 
-    std::cout << AnsiRed << "ERROR, List of valid commands:" << AnsiClear << std::endl;
+    gameOut() << AnsiRed << "ERROR, List of valid commands:" << AnsiClear << std::endl;
     for (size_t i = 0; i < helpStrings.size(); i++) {
-        std::cout << AnsiRed << "\t(" << (i + 1) << ") \"" << helpStrings[i] << "\"" << AnsiClear << std::endl;
+        gameOut() << AnsiRed << "\t(" << (i + 1) << ") \"" << helpStrings[i] << "\"" << AnsiClear << std::endl;
     }
-    std::cout << std::endl;
+    gameOut() << std::endl;
 }
 
 
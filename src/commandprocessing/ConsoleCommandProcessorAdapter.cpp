@@ -2,6 +2,7 @@
 
 #include "../../headers/gameengine/GameEngine.h"
 #include "../../headers/gameengine/State.h"
+#include "../../headers/gameengine/GameOutput.h"
 #include "../../headers/commandprocessing/ConsoleCommandProcessorAdapter.h"
 #include "../../headers/macros/DebugMacros.h"
 
@@ -38,7 +39,7 @@ Command& ConsoleCommandProcessorAdapter::getCommand(const State& currentState) {
             printErrorMenu(currentState.getHelpStringsAsVector());
 
         //  Print invalid command state
-        std::cout << AnsiRed << "[" << (count + 1) << "]\t" << "INVALID COMMAND: " << *command << AnsiClear << std::endl;
+        gameOut() << AnsiRed << "[" << (count + 1) << "]\t" << "INVALID COMMAND: " << *command << AnsiClear << std::endl;
         count++;
     }
 }
@@ -12,6 +12,7 @@
 
 #include "../../headers/gameengine/GameEngine.h"
 #include "../../headers/gameengine/State.h"
+#include "../../headers/gameengine/GameOutput.h"
 #include "../../headers/commandprocessing/FileCommandProcessorAdapter.h"
 #include "../../headers/commandprocessing/ConsoleCommandProcessorAdapter.h"
 #include "../../headers/macros/DebugMacros.h"
@@ -62,7 +63,7 @@ Command& FileCommandProcessorAdapter::getCommand(const State& currentState) {
             printErrorMenu(currentState.getHelpStringsAsVector());
 
         //  Print invalid command state
-        std::cout << AnsiRed << "[" << (count + 1) << "]\t" << "INVALID COMMAND: " << commandQueue.front() << AnsiClear
+        gameOut() << AnsiRed << "[" << (count + 1) << "]\t" << "INVALID COMMAND: " << commandQueue.front() << AnsiClear
                   << std::endl;
         count++;
         commandQueue.pop();
@@ -113,6 +114,10 @@ void FileCommandProcessorAdapter::loadFileContents() {
     DEBUG_PRINT("SUCCESSFULLY LOADED FILE")
 }
 
+bool FileCommandProcessorAdapter::isExhausted() const {
+    return commandQueue.empty();
+}
+
 FileCommandProcessorAdapter* FileCommandProcessorAdapter::clone() const noexcept {
     return new FileCommandProcessorAdapter(filePath);
 }
\ No newline at end of file
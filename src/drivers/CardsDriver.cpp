@@ -4,6 +4,7 @@
 #include "../../headers/Cards.h"
 #include "../../headers/Map.h"
 #include "../../headers/player/Player.h"
+#include "../../headers/Random.h"
 
 void testCards()
 {
@@ -14,7 +15,9 @@ void testCards()
     Territory* france = new Territory("France", 5, 5, europe, player1, 5);
 
     // Create a deck filled with some cards
-    Deck *deck = &Deck::getInstance();
+    Deck *deck = new Deck();
+    // Cards are drawn at random
+    Random random;
     // Create an empty card hand
     std::vector<Card *> hand;
  
@@ -22,7 +25,7 @@ void testCards()
     std::cout << *deck << std::endl;
 
     // Draw one card in the deck
-    Card *card = deck->draw();
+    Card *card = deck->draw(random);
     std::cout << "Card drawn from deck: " << std::endl;
     std::cout << *card << std::endl;
 
@@ -32,8 +35,8 @@ void testCards()
     std::cout << hand << std::endl;
 
     // Draw some cards from the deck and add them to the hand
-    hand.push_back(deck->draw());
-    hand.push_back(deck->draw());
+    hand.push_back(deck->draw(random));
+    hand.push_back(deck->draw(random));
     // Print the cards in the hand
     std::cout << hand << std::endl;
 
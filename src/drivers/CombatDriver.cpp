@@ -0,0 +1,204 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "../../headers/Combat.h"
+#include "../../headers/Random.h"
+
+/** \brief Histogram of the number of kills of <code>samples</code> battles of <code>units</code> units. */
+template <typename Sampler>
+static std::vector<long> killHistogram(Sampler sampler, int units, double probability, int samples, Random &random)
+{
+    std::vector<long> histogram(units + 1, 0);
+    for (int i = 0; i < samples; i++)
+        histogram[sampler(units, probability, random)]++;
+    return histogram;
+}
+
+/** \brief Upper 0.1% critical value of the chi-squared distribution (Wilson-Hilferty approximation). */
+static double chiSquaredCriticalValue(int degreesOfFreedom)
+{
+    const double z = 3.090;
+    const double k = degreesOfFreedom;
+    return k * std::pow(1.0 - 2.0 / (9.0 * k) + z * std::sqrt(2.0 / (9.0 * k)), 3);
+}
+
+/**
+ * \brief   Two-sample chi-squared test of homogeneity between equally sized histograms. Outcomes are pooled into bins
+ *          holding at least 10 observations, so that the statistic is meaningful.
+ * \return  The statistic, with the degrees of freedom through <code>degreesOfFreedom</code>.
+ */
+static double chiSquared(const std::vector<long> &first, const std::vector<long> &second, int &degreesOfFreedom)
+{
+    double statistic = 0.0;
+    int bins = 0;
+    long a = 0;
+    long b = 0;
+    for (size_t k = 0; k < first.size(); k++)
+    {
+        a += first[k];
+        b += second[k];
+        if (a + b >= 10 || k + 1 == first.size())
+        {
+            if (a + b > 0)
+            {
+                statistic += static_cast<double>((a - b) * (a - b)) / static_cast<double>(a + b);
+                bins++;
+            }
+            a = 0;
+            b = 0;
+        }
+    }
+    degreesOfFreedom = std::max(bins - 1, 1);
+    return statistic;
+}
+
+/**
+ * \brief   Checks that the kills drawn by 'sampleKills' follow the same distribution as rolling once per unit, for the
+ *          attacker and the defender probabilities, and a small probability exercising the inversion sampler, with
+ *          armies on both sides of the size rolled unit by unit. Also compares the sample means to the expected number
+ *          of kills.
+ */
+void testCombatDistribution()
+{
+    const std::vector<int> armySizes = {1, 5, 10, 100, 128, 129, 200, 500, 1000, 10000};
+    const std::vector<double> probabilities = {ATTACKER_KILL_PROBABILITY, DEFENDER_KILL_PROBABILITY, 0.02};
+    const int samples = 40000;
+    Random random(345);
+    int failures = 0;
+
+    std::cout << std::setw(8) << "units" << std::setw(8) << "p" << std::setw(12) << "expected" << std::setw(12)
+              << "sampled" << std::setw(12) << "per unit" << std::setw(12) << "chi2" << std::setw(12) << "critical"
+              << std::endl;
+
+    for (double probability : probabilities)
+    {
+        for (int units : armySizes)
+        {
+            auto sampled = killHistogram(&sampleKills, units, probability, samples, random);
+            auto perUnit = killHistogram(&sampleKillsPerUnit, units, probability, samples, random);
+
+            auto mean = [units, samples](const std::vector<long> &histogram)
+            {
+                double sum = 0.0;
+                for (int k = 0; k <= units; k++)
+                    sum += static_cast<double>(k) * static_cast<double>(histogram[k]);
+                return sum / samples;
+            };
+
+            int degreesOfFreedom;
+            double statistic = chiSquared(sampled, perUnit, degreesOfFreedom);
+            double critical = chiSquaredCriticalValue(degreesOfFreedom);
+            bool passed = statistic <= critical;
+            failures += passed ? 0 : 1;
+
+            std::cout << std::fixed << std::setprecision(3) << std::setw(8) << units << std::setw(8) << probability
+                      << std::setw(12) << units * probability << std::setw(12) << mean(sampled) << std::setw(12)
+                      << mean(perUnit) << std::setw(12) << statistic << std::setw(12) << critical
+                      << (passed ? "" : "  MISMATCH") << std::endl;
+        }
+    }
+
+    //  At the 0.1% level, a single failure among the cases above is already unlikely
+    std::cout << (failures == 0 ? "The sampled kills match the per-unit rolls."
+                                : "The sampled kills DO NOT match the per-unit rolls.")
+              << std::endl;
+}
+
+/** \brief Times 'sampleKills' against rolling once per unit, for armies from 1 to 1,000,000 units. */
+void benchmarkCombat()
+{
+    Random random(345);
+
+    std::cout << std::setw(10) << "units" << std::setw(16) << "per unit (ns)" << std::setw(16) << "sampled (ns)"
+              << std::setw(10) << "speedup" << std::endl;
+
+    for (int units = 1; units <= 1000000; units *= 10)
+    {
+        //  Enough battles for about 20 million per-unit rolls, and at least 100 of them
+        const int battles = std::max(100, 20000000 / units);
+        long checksum = 0;
+
+        auto time = [&](int (*sampler)(int, double, Random &))
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < battles; i++)
+                checksum += sampler(units, ATTACKER_KILL_PROBABILITY, random);
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / battles;
+        };
+
+        double perUnit = time(&sampleKillsPerUnit);
+        double sampled = time(&sampleKills);
+
+        std::cout << std::fixed << std::setprecision(1) << std::setw(10) << units << std::setw(16) << perUnit
+                  << std::setw(16) << sampled << std::setw(9) << perUnit / sampled << "x"
+                  << "  (checksum " << checksum << ")" << std::endl;
+    }
+}
+
+/**
+ * \brief   Checks the combat odds against battles played as an advance order plays them, from small battles to battles
+ *          beyond the odds tables, and times a lookup against simulating the battles.
+ */
+void testCombatOdds()
+{
+    const std::vector<std::pair<int, int>> battles = {{1, 1}, {3, 2}, {5, 5}, {10, 6}, {10, 10}, {20, 12}, {40, 25},
+                                                      {100, 60}, {250, 150}, {300, 180}, {1000, 600}, {5000, 3000},
+                                                      {30, 40}, {500, 700}};
+    const int samples = 40000;
+    Random random(345);
+    int failures = 0;
+
+    std::cout << std::setw(12) << "attackers" << std::setw(12) << "defenders" << std::setw(12) << "P(conquest)"
+              << std::setw(12) << "simulated" << std::setw(12) << "survivors" << std::setw(12) << "simulated"
+              << std::endl;
+
+    double simulationTime = 0.0;
+    for (auto [attackers, defenders] : battles)
+    {
+        long conquests = 0;
+        long survivors = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < samples; i++)
+        {
+            int defendersKilled = sampleKills(attackers, ATTACKER_KILL_PROBABILITY, random);
+            int attackersKilled = sampleKills(defenders, DEFENDER_KILL_PROBABILITY, random);
+            conquests += defendersKilled >= defenders ? 1 : 0;
+            survivors += std::max(attackers - attackersKilled, 0);
+        }
+        simulationTime += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        double probability = CombatOdds::conquestProbability(attackers, defenders);
+        double expectedSurvivors = CombatOdds::expectedSurvivors(attackers, defenders);
+        double simulatedProbability = static_cast<double>(conquests) / samples;
+        double simulatedSurvivors = static_cast<double>(survivors) / samples;
+
+        //  Within 5 standard errors of the simulated values, and a little more for the approximated large battles
+        double probabilityError = 5.0 * std::sqrt(probability * (1.0 - probability) / samples) + 0.005;
+        double survivorsError = 5.0 * std::sqrt(defenders * 0.21 / samples) + 0.01 * expectedSurvivors + 0.01;
+        bool passed = std::abs(probability - simulatedProbability) <= probabilityError &&
+                      std::abs(expectedSurvivors - simulatedSurvivors) <= survivorsError;
+        failures += passed ? 0 : 1;
+
+        std::cout << std::fixed << std::setprecision(3) << std::setw(12) << attackers << std::setw(12) << defenders
+                  << std::setw(12) << probability << std::setw(12) << simulatedProbability << std::setw(12)
+                  << expectedSurvivors << std::setw(12) << simulatedSurvivors << (passed ? "" : "  MISMATCH")
+                  << std::endl;
+    }
+
+    const int lookups = 10000000;
+    double checksum = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < lookups; i++)
+        checksum += CombatOdds::conquestProbability(i % 200 + 1, i % 150 + 1);
+    double lookupTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << (failures == 0 ? "The combat odds match the simulated battles."
+                                : "The combat odds DO NOT match the simulated battles.")
+              << std::endl;
+    std::cout << std::setprecision(1) << "A lookup takes " << lookupTime / lookups << " ns, simulating a battle "
+              << simulationTime / (samples * battles.size()) << " ns (checksum " << checksum << ")" << std::endl;
+}
@@ -1,10 +1,32 @@
 #include <vector>
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <numeric>
 
 #include "../../headers/gameengine/GameEngine.h"
 #include "../../headers/gameengine/TransitionFunctions.h"
+#include "../../headers/gameengine/GameOutput.h"
+#include "../../headers/gameengine/GameState.h"
 #include "../../headers/commandprocessing/CommandProcessing.h"
+#include "../../headers/player/Player.h"
+#include "../../headers/player/PlayerStrategies.h"
+#include "../../headers/Orders.h"
+#include "../../headers/Map.h"
+#include "../../headers/Cards.h"
+#include "../../headers/ThreadPool.h"
+#include "../../headers/AllocationCounter.h"
 
-void testGameStates(CommandProcessor* commandProcessor)
+/**
+ * \brief   Plays the game with the commands of the given command processor
+ * \param observer  Attached to the game engine if not null, and deleted once the game is over
+ */
+void testGameStates(CommandProcessor* commandProcessor, bool headless, std::uint64_t seed, Observer* observer)
 {
     //  Instantiating the states
     auto* start = new State("start");
@@ -16,8 +38,9 @@ void testGameStates(CommandProcessor* commandProcessor)
     auto* end = new State("END");
 
     //  Inserting the transitions
-    start->addTransition("loadmap", mapLoaded, 1, "loadmap [--filepath]", &game_loadMap);
-    mapLoaded->addTransition("loadmap", mapLoaded, 1, "loadmap [--filepath]", &game_loadMap);
+    start->addTransition("loadmap", mapLoaded, 1, "loadmap [--filepath] [-binary]", &game_loadMap);
+    start->addTransition("tournament", win, 8, "tournament -M [--mapfiles] -P [--strategies] -G [--games] -D [--maxturns] [-T [--threads]]", &game_tournament);
+    mapLoaded->addTransition("loadmap", mapLoaded, 1, "loadmap [--filepath] [-binary]", &game_loadMap);
     mapLoaded->addTransition("validatemap", mapValidated, 0, "validatemap", &game_validateMap);
     mapValidated->addTransition("addplayer", playersAdded, 1, "addplayer [--playername]", &game_addPlayer);
     playersAdded->addTransition("addplayer", playersAdded, 1, "addplayer [--playername]", &game_addPlayer);
@@ -30,8 +53,414 @@ void testGameStates(CommandProcessor* commandProcessor)
     //  Initialize required objects
     std::vector<State*> states = { start, mapLoaded, mapValidated, playersAdded, gameLoop, win, end };
     auto* gameEngine = new GameEngine(states, commandProcessor);
+    gameEngine->setHeadless(headless);
+    gameEngine->setSeed(seed);
+    if (observer != nullptr)
+        gameEngine->Attach(observer);
 
+    auto startTime = std::chrono::steady_clock::now();
     gameEngine->execute();
 
+    //  Headless runs only report how long they took
+    if (headless)
+    {
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime);
+        std::cout << "Headless run finished in " << elapsed.count() << " ms (seed " << seed << ")" << std::endl;
+    }
+
     delete gameEngine;
-}
\ No newline at end of file
+    delete observer;
+}
+/** \brief Loads and validates the map the driver games are played on, printing an error if it cannot be. */
+static std::unique_ptr<Map> loadDriverMap(const std::string &purpose)
+{
+    std::unique_ptr<Map> map(MapLoader("../maps/Cornwall.map").load());
+    if (map == nullptr || !map->validate())
+    {
+        std::cerr << "ERROR: Cannot load the map of the " << purpose << std::endl;
+        return nullptr;
+    }
+    return map;
+}
+
+/**
+ * \brief   Starts a headless game on a copy of a map, from a seed, with a player of each of the given strategies named
+ *          after it. Starting the game plays its first turn, every further game loop plays one more.
+ * \return  Whether the game started.
+ */
+static bool startDriverGame(GameEngine &gameEngine, const Map &map, std::uint64_t seed,
+                            const std::vector<const char *> &strategies)
+{
+    gameEngine.setHeadless(true);
+    gameEngine.setMaxTurns(1);
+    gameEngine.setSeed(seed);
+    gameEngine.setMap(new Map(map));
+    for (const char *strategy : strategies)
+        game_addPlayer({strategy, strategy}, gameEngine);
+    return game_gameStart({}, gameEngine);
+}
+
+/** \brief Returns the number of cards of a game: the ones left in its deck and the ones in the hands of its players. */
+static int countCards(GameEngine &gameEngine)
+{
+    int cards = gameEngine.getDeck().getDeckSize();
+    for (Player *player : gameEngine.getPlayers())
+        cards += static_cast<int>(player->getCards().size());
+    return cards;
+}
+
+/**
+ * \brief   Plays many games at once on a thread pool, one turn at a time, checking after every turn that each game
+ *          still has exactly the cards its deck started with. Cards going missing or being duplicated would show a
+ *          deck shared between games, or a card being returned twice.
+ */
+void testConcurrentGames()
+{
+    const int numGames = 1000;
+    const int maxTurns = 100;
+    const std::vector<std::vector<const char *>> lineUps = {
+        {"aggressive", "benevolent", "neutral"},
+        {"aggressive", "aggressive", "benevolent", "benevolent"},
+        {"aggressive", "cheater", "benevolent"},
+    };
+
+    std::unique_ptr<Map> map = loadDriverMap("concurrent games");
+    if (map == nullptr)
+        return;
+
+    std::atomic<int> violations = 0;
+    std::atomic<long> turnsChecked = 0;
+    ThreadPool pool;
+    std::vector<std::future<void>> games;
+
+    auto startTime = std::chrono::steady_clock::now();
+    for (int i = 0; i < numGames; i++)
+    {
+        const std::vector<const char *> &lineUp = lineUps[i % lineUps.size()];
+        games.push_back(pool.submit([&map, &lineUp, &violations, &turnsChecked, maxTurns, i]
+        {
+            QuietGameOutput quietOutput;
+
+            GameEngine gameEngine;
+            const int totalCards = gameEngine.getDeck().getDeckSize();
+            bool started = startDriverGame(gameEngine, *map, i, lineUp);
+            for (int turn = 1; started && turn <= maxTurns; turn++)
+            {
+                if (countCards(gameEngine) != totalCards)
+                {
+                    violations++;
+                    break;
+                }
+                turnsChecked++;
+
+                if (gameEngine.getWinner() != nullptr || gameEngine.getPlayers().empty() || turn == maxTurns)
+                    break;
+                gameEngine.mainGameLoop();
+            }
+        }));
+    }
+    for (auto &game : games)
+        game.get();
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    std::cout << "Played " << numGames << " games on " << pool.size() << " threads in " << elapsed << " s, checked "
+              << turnsChecked << " turns: " << (violations == 0 ? "every card accounted for" : "CARDS LOST OR DUPLICATED")
+              << " (" << violations << " game(s) failed)" << std::endl;
+}
+
+/**
+ * \brief   Plays games one turn at a time, counting the heap allocations of every turn, e.g. to check that reading the
+ *          territories and players of the game does not copy them.
+ * \remarks Needs the allocation counter, built in with the CMake option COUNT_ALLOCATIONS.
+ */
+void benchmarkTurnAllocations()
+{
+#ifndef COUNT_ALLOCATIONS
+    std::cerr << "ERROR: Allocations are only counted when built with the CMake option COUNT_ALLOCATIONS" << std::endl;
+#else
+    const int numGames = 20;
+    const int maxTurns = 100;
+
+    std::unique_ptr<Map> map = loadDriverMap("allocation benchmark");
+    if (map == nullptr)
+        return;
+
+    long turnsPlayed = 0;
+    size_t allocations = 0;
+    size_t mostAllocations = 0;
+    for (int i = 0; i < numGames; i++)
+    {
+        QuietGameOutput quietOutput;
+        GameEngine gameEngine;
+        if (!startDriverGame(gameEngine, *map, i, {"aggressive", "benevolent", "aggressive", "neutral"}))
+            continue;
+        for (int turn = 2; turn <= maxTurns; turn++)
+        {
+            if (gameEngine.getWinner() != nullptr || gameEngine.getPlayers().empty())
+                break;
+            size_t turnStart = AllocationCounter::allocations();
+            gameEngine.mainGameLoop();
+            size_t turnAllocations = AllocationCounter::allocations() - turnStart;
+            allocations += turnAllocations;
+            mostAllocations = std::max(mostAllocations, turnAllocations);
+            turnsPlayed++;
+        }
+    }
+
+    std::cout << "Played " << numGames << " games, " << turnsPlayed << " turns: "
+              << static_cast<double>(allocations) / static_cast<double>(turnsPlayed) << " heap allocation(s) per turn, "
+              << mostAllocations << " in the busiest turn" << std::endl;
+#endif
+}
+
+/**
+ * \brief   Checks that executing orders makes no Order object, and no heap allocation when built with
+ *          COUNT_ALLOCATIONS, once the first turns of a game have grown the buffers it reuses
+ */
+void testOrdersPhaseAllocations()
+{
+    const int numGames = 20;
+    const int maxTurns = 100;
+    const int warmUpTurns = 5;
+
+    std::unique_ptr<Map> map = loadDriverMap("orders phase allocation test");
+    if (map == nullptr)
+        return;
+
+    long turnsChecked = 0;
+    long allocatingTurns = 0;
+    size_t ordersBoxed = 0;
+    size_t heapAllocations = 0;
+    for (int i = 0; i < numGames; i++)
+    {
+        QuietGameOutput quietOutput;
+        GameEngine gameEngine;
+        if (!startDriverGame(gameEngine, *map, i, {"aggressive", "benevolent", "aggressive", "neutral"}))
+            continue;
+        for (int turn = 2; turn <= maxTurns; turn++)
+        {
+            if (gameEngine.getWinner() != nullptr || gameEngine.getPlayers().empty())
+                break;
+            gameEngine.mainGameLoop();
+            if (turn <= warmUpTurns)
+                continue;
+            GameEngine::OrdersPhaseAllocations allocations = gameEngine.getLastOrdersPhaseAllocations();
+            ordersBoxed += allocations.ordersBoxed;
+            heapAllocations += allocations.heapAllocations;
+            if (allocations.ordersBoxed != 0 || allocations.heapAllocations != 0)
+                allocatingTurns++;
+            turnsChecked++;
+        }
+    }
+
+    std::cout << "Checked the orders phase of " << turnsChecked << " turns after the first " << warmUpTurns << ": "
+              << ordersBoxed << " Order object(s), " << heapAllocations << " heap allocation(s)";
+#ifndef COUNT_ALLOCATIONS
+    std::cout << " (not counted without COUNT_ALLOCATIONS)";
+#endif
+    std::cout << std::endl;
+    if (allocatingTurns != 0)
+        std::cerr << "ERROR: " << allocatingTurns << " turn(s) allocated while executing orders" << std::endl;
+}
+
+/**
+ * \brief   Times forking game states, and checks that a game played on for a few turns is restored by applying back
+ *          the state it was captured in.
+ */
+void benchmarkGameState()
+{
+    const int numForks = 1000000;
+    const int turnsPlayedOn = 5;
+
+    std::unique_ptr<Map> map = loadDriverMap("game state benchmark");
+    if (map == nullptr)
+        return;
+
+    QuietGameOutput quietOutput;
+    GameEngine gameEngine;
+    if (!startDriverGame(gameEngine, *map, 1, {"aggressive", "benevolent", "aggressive"}))
+        return;
+
+    GameState captured(gameEngine);
+    GameState fork;
+    long long totalArmies = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numForks; i++)
+    {
+        fork.forkFrom(captured);
+        fork.setArmies(i % fork.getNumTerritories(), i);
+        totalArmies += fork.getArmies(i % fork.getNumTerritories());
+    }
+    double forkTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    for (int turn = 0; turn < turnsPlayedOn && gameEngine.getWinner() == nullptr; turn++)
+        gameEngine.mainGameLoop();
+    bool changed = GameState(gameEngine) != captured;
+    bool applied = captured.applyTo(gameEngine);
+    bool restored = GameState(gameEngine) == captured;
+
+    std::cout << "Forked a state of " << captured.getNumTerritories() << " territories and " << captured.getNumPlayers()
+              << " players " << numForks << " times: " << forkTime / numForks << " ns per fork ("
+              << static_cast<long long>(numForks / (forkTime / 1e9)) << " forks per second, checksum " << totalArmies
+              << ")" << std::endl;
+    std::cout << "Played on " << turnsPlayedOn << " turns (state " << (changed ? "changed" : "UNCHANGED")
+              << "), applied the state back: " << (applied && restored ? "game restored" : "GAME NOT RESTORED")
+              << std::endl;
+}
+
+/**
+ * \brief   Times the search of the MCTS player on a game in progress, with more and more threads, then plays it against
+ *          the aggressive and benevolent players.
+ */
+void benchmarkMcts()
+{
+    const std::chrono::milliseconds searchTime(500);
+    const int numGames = 10;
+    const int maxTurns = 100;
+
+    std::unique_ptr<Map> map = loadDriverMap("MCTS benchmark");
+    if (map == nullptr)
+        return;
+
+    const std::vector<const char *> lineUp = {"mcts", "aggressive", "benevolent"};
+    {
+        QuietGameOutput quietOutput;
+        GameEngine gameEngine;
+        if (!startDriverGame(gameEngine, *map, 1, lineUp))
+            return;
+        Player *player = gameEngine.getPlayerByName("mcts");
+
+        //  Every search starts from the same position, with reinforcements to deploy, and is undone afterwards
+        player->setReinforcements(10);
+        GameState position(gameEngine);
+        std::vector<unsigned> threadCounts = {1};
+        for (unsigned threads = 2; threads < ThreadPool::hardwareThreads(); threads *= 2)
+            threadCounts.push_back(threads);
+        if (ThreadPool::hardwareThreads() > 1)
+            threadCounts.push_back(ThreadPool::hardwareThreads());
+
+        for (unsigned threads : threadCounts)
+        {
+            MctsPlayerStrategy strategy(player, 0, threads, searchTime);
+            strategy.issueOrders(&gameEngine);
+            while (Order *order = player->getOrdersList()->getNextOrder())
+                delete order;
+            position.applyTo(gameEngine);
+
+            MctsPlayerStrategy::SearchStatistics search = strategy.getLastSearch();
+            double rolloutsPerSecond = static_cast<double>(search.rollouts) / search.seconds;
+            std::cout << search.threads << " thread(s): " << search.rollouts << " playouts in " << search.seconds
+                      << " s, " << static_cast<long>(rolloutsPerSecond) << " playouts per second, "
+                      << static_cast<long>(rolloutsPerSecond / search.threads) << " per thread" << std::endl;
+        }
+    }
+
+    std::vector<int> wins(lineUp.size(), 0);
+    auto startTime = std::chrono::steady_clock::now();
+    for (int i = 0; i < numGames; i++)
+    {
+        QuietGameOutput quietOutput;
+        GameEngine gameEngine;
+        if (!startDriverGame(gameEngine, *map, i, lineUp))
+            continue;
+        for (int turn = 2; turn <= maxTurns && gameEngine.getWinner() == nullptr; turn++)
+            gameEngine.mainGameLoop();
+        if (gameEngine.getWinner() == nullptr)
+            continue;
+        auto winner = std::ranges::find(lineUp, gameEngine.getWinner()->getName());
+        if (winner != lineUp.end())
+            wins[winner - lineUp.begin()]++;
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    std::cout << "Played " << numGames << " games in " << elapsed << " s, wins:";
+    for (size_t i = 0; i < lineUp.size(); i++)
+        std::cout << " " << lineUp[i] << " " << wins[i];
+    std::cout << ", draws " << numGames - std::accumulate(wins.begin(), wins.end(), 0) << std::endl;
+}
+
+/**
+ * \brief   Plays games one turn at a time, checking after every turn that the frontier of each player (border
+ *          territories and enemy neighbours) is the one found by scanning their territories and every neighbour, and
+ *          times both ways of getting it.
+ */
+void testFrontier()
+{
+    const int numGames = 100;
+    const int maxTurns = 100;
+    const std::vector<std::vector<const char *>> lineUps = {
+        {"aggressive", "benevolent", "neutral"},
+        {"aggressive", "cheater", "benevolent"},
+        {"cheater", "aggressive", "aggressive", "benevolent"},
+    };
+
+    std::unique_ptr<Map> map = loadDriverMap("frontier test");
+    if (map == nullptr)
+        return;
+
+    //  The frontier of a player as it used to be found, sorted to be compared
+    auto scanFrontier = [](const Player &player, std::vector<Territory *> &borders, std::vector<Territory *> &enemies)
+    {
+        borders.clear();
+        enemies.clear();
+        for (Territory *territory : player.getTerritories())
+        {
+            for (Territory *adjacent : territory->getAdjacentTerritories())
+            {
+                if (adjacent->getOwner() == &player)
+                    continue;
+                if (borders.empty() || borders.back() != territory)
+                    borders.push_back(territory);
+                if (std::ranges::find(enemies, adjacent) == enemies.end())
+                    enemies.push_back(adjacent);
+            }
+        }
+    };
+    auto sorted = [](std::span<Territory *const> territories)
+    {
+        std::vector<Territory *> copy(territories.begin(), territories.end());
+        std::ranges::sort(copy);
+        return copy;
+    };
+
+    int mismatches = 0;
+    long frontiersChecked = 0;
+    double scanTime = 0.0;
+    double readTime = 0.0;
+    size_t checksum = 0;
+    std::vector<Territory *> borders;
+    std::vector<Territory *> enemies;
+    for (int i = 0; i < numGames; i++)
+    {
+        QuietGameOutput quietOutput;
+        GameEngine gameEngine;
+        bool started = startDriverGame(gameEngine, *map, i, lineUps[i % lineUps.size()]);
+        for (int turn = 1; started && turn <= maxTurns; turn++)
+        {
+            for (const Player *player : gameEngine.getPlayers())
+            {
+                auto start = std::chrono::steady_clock::now();
+                scanFrontier(*player, borders, enemies);
+                auto scanned = std::chrono::steady_clock::now();
+                checksum += player->getBorderTerritories().size() + player->getEnemyNeighbours().size();
+                auto read = std::chrono::steady_clock::now();
+                scanTime += std::chrono::duration<double, std::nano>(scanned - start).count();
+                readTime += std::chrono::duration<double, std::nano>(read - scanned).count();
+
+                if (sorted(player->getBorderTerritories()) != sorted(borders) ||
+                    sorted(player->getEnemyNeighbours()) != sorted(enemies))
+                    mismatches++;
+                frontiersChecked++;
+            }
+            if (gameEngine.getWinner() != nullptr || gameEngine.getPlayers().empty())
+                break;
+            gameEngine.mainGameLoop();
+        }
+    }
+
+    std::cout << "Checked " << frontiersChecked << " frontiers: "
+              << (mismatches == 0 ? "all match the scanned ones" : std::to_string(mismatches) + " MISMATCH(ES)")
+              << std::endl;
+    std::cout << "Scanning a frontier takes " << scanTime / frontiersChecked << " ns, reading it "
+              << readTime / frontiersChecked << " ns (checksum " << checksum << ")" << std::endl;
+}
@@ -1,42 +1,111 @@
 #include <cstring>
+#include <cstdint>
 #include <iostream>
+#include <string>
 
 
 #include "../../headers/gameengine/GameEngine.h"        //  TODO: Command processor inheritance only works w/ this include directive. Figure out why
 #include "../../headers/commandprocessing/ConsoleCommandProcessorAdapter.h"
 #include "../../headers/commandprocessing/FileCommandProcessorAdapter.h"
+#include "../../headers/Random.h"
+#include "../../headers/LoggingObserver.h"
+#include "../../headers/BinaryLogObserver.h"
 
 void testCards();
-void testGameStates(CommandProcessor*);
+void testGameStates(CommandProcessor*, bool headless = false, std::uint64_t seed = Random::randomSeed(),
+                    Observer *observer = nullptr);
+void testConcurrentGames();
+void benchmarkTurnAllocations();
+void testOrdersPhaseAllocations();
+void benchmarkGameState();
+void benchmarkMcts();
+void testFrontier();
 void testLoadMaps();
+void testParallelMapLoading();
 void testOrdersLists();
 void testOrderExecution();
+void benchmarkOrdersList();
+void benchmarkOrderValidation();
+void testCombatDistribution();
+void benchmarkCombat();
+void testCombatOdds();
 void testPlayers();
 void testLoggingObserver(CommandProcessor*);
+void benchmarkLogging();
 
 int main(int argc, char *argv[])
 {
     //  Determining what command processor to use
-    CommandProcessor* commandProcessor = new ConsoleCommandProcessorAdapter();
+    CommandProcessor* commandProcessor = nullptr;
+    //  Headless runs play the commands of a file without prompts or console output
+    bool headless = false;
+    //  Games are random unless a seed is given last, as '-seed N', to replay them
+    std::uint64_t seed = Random::randomSeed();
+    //  Events are logged as text ('-log', to gamelog.txt) or as binary records ('-binarylog', to gamelog.bin)
+    Observer *observer = nullptr;
+    while (argc > 1) {
+        if (argc > 2 && std::strcmp(*(argv + argc - 2), "-seed") == 0) {
+            try {
+                seed = std::stoull(*(argv + argc - 1));
+            } catch (const std::exception &) {
+                std::cerr << "ERROR: Invalid seed \"" << *(argv + argc - 1) << "\"" << std::endl;
+                delete observer;
+                return 0;
+            }
+            argc -= 2;
+        } else if (std::strcmp(*(argv + argc - 1), "-log") == 0 || std::strcmp(*(argv + argc - 1), "-binarylog") == 0) {
+            if (observer != nullptr) {
+                std::cerr << "ERROR: Only one of -log and -binarylog can be given" << std::endl;
+                delete observer;
+                return 0;
+            }
+            if (std::strcmp(*(argv + argc - 1), "-log") == 0)
+                observer = new LogObserver();
+            else
+                observer = new BinaryLogObserver();
+            argc--;
+        } else {
+            break;
+        }
+    }
     //  If there are arguments
     if (argc > 1) {
         if (std::strcmp(*(argv + 1), "-console") == 0 && argc == 2) {
             commandProcessor = new ConsoleCommandProcessorAdapter();
         } else if (std::strcmp(*(argv + 1), "-file") == 0 && argc == 3) {
             commandProcessor = new FileCommandProcessorAdapter(*(argv + 2));
+        } else if (std::strcmp(*(argv + 1), "-headless") == 0 && argc == 3) {
+            commandProcessor = new FileCommandProcessorAdapter(*(argv + 2));
+            headless = true;
         } else {
             std::cerr << "ERROR: Incorrect arguments provided" << std::endl;
+            delete observer;
             return 0;
         }
+    } else {
+        commandProcessor = new ConsoleCommandProcessorAdapter();
     }
 
     //  testLoadMaps();
+    //  testParallelMapLoading();
     //  testOrdersLists();
     //  testOrderExecution();
+    //  benchmarkOrdersList();
+    //  benchmarkOrderValidation();
+    //  testCombatDistribution();
+    //  benchmarkCombat();
+    //  testCombatOdds();
     //  testCards();
     //  testPlayers();
     //  testLoggingObserver(commandProcessor);
-    testGameStates(commandProcessor);
+    //  benchmarkLogging();
+    //  testConcurrentGames();
+    //  benchmarkTurnAllocations();
+    //  testOrdersPhaseAllocations();
+    //  benchmarkGameState();
+    //  benchmarkMcts();
+    //  testFrontier();
+    testGameStates(commandProcessor, headless, seed, observer);
 
     return 0;
 }
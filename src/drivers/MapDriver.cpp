@@ -1,6 +1,11 @@
 #include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <chrono>
+#include <cstdio>
 
 #include "../../headers/Map.h"
+#include "../../headers/ThreadPool.h"
 
 
 
@@ -38,4 +43,71 @@ void testLoadMaps()
             std::cout << "\"" << mapFile << "\" is not valid!\n\n";
         }
     }
-}
\ No newline at end of file
+}
+// Writes a synthetic, connected map: a grid of territories split into horizontal bands of continents, each territory
+// adjacent to its grid neighbours
+static void writeSyntheticMap(const std::string &filePath, size_t width, size_t height, size_t numContinents)
+{
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    const size_t rowsPerContinent = (height + numContinents - 1) / numContinents;
+
+    file << "[Map]\nauthor=synthetic\n\n[Continents]\n";
+    for (size_t c = 0; c < numContinents; ++c)
+    {
+        file << "Continent" << c << "=" << (c % 7) + 1 << "\n";
+    }
+
+    file << "\n[Territories]\n";
+    for (size_t row = 0; row < height; ++row)
+    {
+        for (size_t column = 0; column < width; ++column)
+        {
+            file << "T" << row << "_" << column << "," << column << "," << row << ",Continent" << row / rowsPerContinent;
+            if (row > 0)
+                file << ",T" << row - 1 << "_" << column;
+            if (row + 1 < height)
+                file << ",T" << row + 1 << "_" << column;
+            if (column > 0)
+                file << ",T" << row << "_" << column - 1;
+            if (column + 1 < width)
+                file << ",T" << row << "_" << column + 1;
+            file << "\n";
+        }
+        file << "\n";
+    }
+}
+
+// Times the sequential and parallel map loaders on a synthetic map of 250,000 territories
+void testParallelMapLoading()
+{
+    const std::string mapFile = "synthetic_250k.map";
+    writeSyntheticMap(mapFile, 500, 500, 100);
+
+    auto timeLoad = [&mapFile](const std::string &label, MapLoader::Mode mode, unsigned numThreads) {
+        MapLoader loader(mapFile, mode, numThreads);
+        auto start = std::chrono::steady_clock::now();
+        Map *map = loader.load();
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        bool valid = map && map->validate();
+
+        std::cout << std::left << std::setw(24) << label << std::right << std::setw(10) << std::fixed
+                  << std::setprecision(1) << elapsed.count() << " ms";
+        if (map)
+        {
+            std::cout << "  (" << map->getNumTerritories() << " territories, "
+                      << (valid ? "valid" : "NOT VALID") << ")";
+        }
+        std::cout << "\n\n";
+        delete map;
+    };
+
+    timeLoad("Buffered", MapLoader::Mode::Buffered, 0);
+    timeLoad("Memory mapped", MapLoader::Mode::MemoryMapped, 0);
+    for (unsigned numThreads = 1; numThreads <= ThreadPool::hardwareThreads(); numThreads *= 2)
+    {
+        timeLoad("Parallel, " + std::to_string(numThreads) + " threads", MapLoader::Mode::Parallel, numThreads);
+    }
+    timeLoad("Parallel, hardware", MapLoader::Mode::Parallel, 0);
+
+    std::remove(mapFile.c_str());
+}
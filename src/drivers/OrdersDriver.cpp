@@ -1,8 +1,63 @@
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <span>
+#include <utility>
+#include <variant>
+#include <vector>
+
 #include "../../headers/Orders.h"
+#include "../../headers/Random.h"
+#include "../../headers/gameengine/GameOutput.h"
+#include "../../headers/gameengine/NegotiationMatrix.h"
 #include "../../headers/player/Player.h"
 #include "../../headers/Map.h"
 #include "../../headers/Cards.h"
 
+/**
+ * \brief   Builds the map the order drivers issue orders on: France, Belgium and England, all bordering each other,
+ *          and Greece, bordering none of them, in Europe. Greece, France and Belgium go to the first player, England to
+ *          the second, with 5 units each.
+ * \remarks Territories are given to their owners once the map is linked, as in a game, so that players index them
+ *          by their ids in the map. Deleting the map deletes its continents and territories.
+ */
+Map *buildEuropeMap(Player *player1, Player *player2)
+{
+    auto *map = new Map();
+    auto *europe = new Continent("Europe", 100);
+    map->addContinent(europe);
+
+    auto addTerritory = [map, europe](const std::string &name, int x, int y)
+    {
+        auto *territory = new Territory(name, x, y, europe, nullptr, 5);
+        europe->addTerritory(territory);
+        map->addTerritory(territory);
+        return territory;
+    };
+    Territory *france = addTerritory("France", 5, 5);
+    Territory *belgium = addTerritory("Belgium", 6, 4);
+    Territory *england = addTerritory("England", 5, 3);
+    Territory *greece = addTerritory("Greece", 10, 12);
+
+    france->addAdjacentTerritory(belgium);
+    france->addAdjacentTerritory(england);
+    belgium->addAdjacentTerritory(france);
+    belgium->addAdjacentTerritory(england);
+    england->addAdjacentTerritory(france);
+    england->addAdjacentTerritory(belgium);
+    map->buildAdjacency();
+
+    for (auto [territory, owner] : {std::pair{france, player1}, {belgium, player1}, {england, player2}, {greece, player1}})
+    {
+        territory->setOwner(owner);
+        owner->addTerritory(*territory);
+    }
+    return map;
+}
+
 /**
  * \brief Tests Order-related functionality specified for Assignment I
  */
@@ -11,6 +66,14 @@ void testOrdersLists()
      auto* player1 = new Player("player1");
      auto* player2 = new Player("player1");
 
+     //  Seating the players at the truces of a game, and giving them its neutral player, as the game engine does
+     NegotiationMatrix negotiations;
+     Player neutralPlayer("Neutral");
+     for (Player *player : {player1, player2})
+          player->setNeutralPlayer(&neutralPlayer);
+     player1->setNegotiations(&negotiations, 0);
+     player2->setNegotiations(&negotiations, 1);
+
      player1->addToReinforcementPool(3);
      player2->addToReinforcementPool(2);
 
@@ -24,19 +87,11 @@ void testOrdersLists()
      player2->addCard(*(new Card(type::airlift)));
      player2->addCard(*(new Card(type::diplomacy)));
 
-     auto *europe = new Continent("Europe", 100);
-
-     auto* france =  new Territory("France", 5, 5, europe, player1, 5);
-     auto* belgium = new Territory("Belgium", 6, 4, europe, player1, 5);
-     auto* england = new Territory("England", 5, 3, europe, player2, 5);
-     auto* greece =  new Territory("Greece", 10, 12, europe, player1, 5);
-
-    france->addAdjacentTerritory(belgium);
-    france->addAdjacentTerritory(england);
-    belgium->addAdjacentTerritory(france);
-    belgium->addAdjacentTerritory(england);
-    england->addAdjacentTerritory(france);
-    england->addAdjacentTerritory(belgium);
+     Map *map = buildEuropeMap(player1, player2);
+     Territory *france = map->getTerritoryByName("France");
+     Territory *belgium = map->getTerritoryByName("Belgium");
+     Territory *england = map->getTerritoryByName("England");
+     Territory *greece = map->getTerritoryByName("Greece");
 
     player1->issueOrder("deploy", france, 3, nullptr, nullptr);
     player1->issueOrder("advance", belgium, 4, france, nullptr);
@@ -67,11 +122,7 @@ void testOrdersLists()
     cout << "\nInvalid Orders:\n";
     player2->getOrdersList()->apply(executeOrderFunction);
 
-    delete europe;
-    delete france;
-    delete belgium;
-    delete england;
-    delete greece;
+    delete map;
 
     delete player1;
     delete player2;
@@ -84,6 +135,14 @@ void testOrderExecution()
 {
      auto *player1 = new Player();
      auto *player2 = new Player();
+
+     //  Seating the players at the truces of a game, and giving them its neutral player, as the game engine does
+     NegotiationMatrix negotiations;
+     Player neutralPlayer("Neutral");
+     for (Player *player : {player1, player2})
+          player->setNeutralPlayer(&neutralPlayer);
+     player1->setNegotiations(&negotiations, 0);
+     player2->setNegotiations(&negotiations, 1);
      player1->addToReinforcementPool(3);
      player1->setPlayerName("Shadow");
      player2->addToReinforcementPool(2);
@@ -98,19 +157,11 @@ void testOrderExecution()
      player2->addCard(*(new Card(type::airlift)));
      player2->addCard(*(new Card(type::diplomacy)));
 
-     Continent *europe = new Continent("Europe", 100);
-
-     Territory *france = new Territory("France", 5, 5, europe, player1, 5);
-     Territory *belgium = new Territory("Belgium", 6, 4, europe, player1, 5);
-     Territory *england = new Territory("England", 5, 3, europe, player2, 5);
-     Territory *greece = new Territory("Greece", 10, 12, europe, player1, 5);
-
-     france->addAdjacentTerritory(belgium);
-     france->addAdjacentTerritory(england);
-     belgium->addAdjacentTerritory(france);
-     belgium->addAdjacentTerritory(england);
-     england->addAdjacentTerritory(france);
-     england->addAdjacentTerritory(belgium);
+     Map *map = buildEuropeMap(player1, player2);
+     Territory *france = map->getTerritoryByName("France");
+     Territory *belgium = map->getTerritoryByName("Belgium");
+     Territory *england = map->getTerritoryByName("England");
+     Territory *greece = map->getTerritoryByName("Greece");
 
      player2->issueOrder("deploy", france, 2, NULL, NULL);     // Invalid Deploy
      player2->issueOrder("advance", england, 5, france, NULL); // Invalid Advance: not owner of source
@@ -192,4 +243,216 @@ void testOrderExecution()
      cout << *belgium << endl
           << *france << endl;
      cout << "\n-------------------------------------------------------------\n\n";
-}
\ No newline at end of file
+
+     delete map;
+
+     delete player1;
+     delete player2;
+}
+
+/**
+ * \brief   Times issue/execute cycles of deploy orders with thousands of orders queued per player, and reordering
+ *          orders in place, against a <code>std::list</code> of Order objects (how orders lists used to be kept).
+ */
+void benchmarkOrdersList()
+{
+    QuietGameOutput quietOutput;
+    Random random(1);
+
+    auto *player = new Player("player");
+    auto *continent = new Continent("Continent", 1);
+    auto *territory = new Territory("Territory", 0, 0, continent, player, 0);
+    player->addTerritory(*territory);
+
+    for (int queued : {1000, 10000, 100000})
+    {
+        const int cycles = std::max(1, 2000000 / queued);
+        OrdersList *ordersList = player->getOrdersList();
+
+        //  Issuing a turn of orders, then executing them all
+        auto start = std::chrono::steady_clock::now();
+        for (int cycle = 0; cycle < cycles; cycle++)
+        {
+            player->addToReinforcementPool(queued);
+            for (int i = 0; i < queued; i++)
+                player->issueOrder(Order::OrderType::Deploy, territory, 1, nullptr, nullptr);
+            while (ordersList->executeNextOrder())
+            {
+            }
+        }
+        double ringTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        std::list<Order *> legacyList;
+        start = std::chrono::steady_clock::now();
+        for (int cycle = 0; cycle < cycles; cycle++)
+        {
+            for (int i = 0; i < queued; i++)
+                legacyList.push_back(new DeployOrder(player, territory, 1));
+            while (!legacyList.empty())
+            {
+                Order *order = legacyList.front();
+                legacyList.pop_front();
+                order->execute();
+                delete order;
+            }
+        }
+        double listTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        //  Moving random orders of a full list to random positions
+        const int moves = std::max(200, 20000000 / queued);
+        player->addToReinforcementPool(queued);
+        for (int i = 0; i < queued; i++)
+        {
+            player->issueOrder(Order::OrderType::Deploy, territory, 1, nullptr, nullptr);
+            legacyList.push_back(new DeployOrder(player, territory, 1));
+        }
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < moves; i++)
+            ordersList->reorder(random.nextIndex(queued), random.nextIndex(queued));
+        double ringMoveTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < moves; i++)
+        {
+            auto from = legacyList.begin();
+            std::advance(from, random.nextIndex(queued));
+            Order *order = *from;
+            legacyList.erase(from);
+            auto to = legacyList.begin();
+            std::advance(to, random.nextIndex(queued));
+            legacyList.insert(to, order);
+        }
+        double listMoveTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        while (ordersList->executeNextOrder())
+        {
+        }
+        for (Order *order : legacyList)
+            delete order;
+        legacyList.clear();
+
+        const double ordersPerRun = static_cast<double>(cycles) * queued;
+        std::cout << queued << " orders queued:" << std::endl;
+        std::cout << "  Issue + execute, orders list: " << ringTime / ordersPerRun << " ns per order" << std::endl;
+        std::cout << "  Issue + execute, std::list:   " << listTime / ordersPerRun << " ns per order" << std::endl;
+        std::cout << "  Reorder, orders list:         " << ringMoveTime / moves << " ns per move" << std::endl;
+        std::cout << "  Reorder, std::list:           " << listMoveTime / moves << " ns per move" << std::endl;
+    }
+
+    delete player;
+    delete territory;
+    delete continent;
+}
+
+/**
+ * \brief   Times the validation of deploy, advance, bomb and airlift orders on square grid maps, with a player owning
+ *          the left half of the map, against the ownership and adjacency checks scanning the player's territories
+ *          (how they used to be made).
+ */
+void benchmarkOrderValidation()
+{
+    Random random(1);
+
+    for (int width : {10, 32, 100})
+    {
+        //  Building a grid map: every territory borders the ones above, below, left and right of it
+        Map map;
+        auto *continent = new Continent("Grid", 1);
+        map.addContinent(continent);
+        auto *player = new Player("player");
+        auto *enemy = new Player("enemy");
+        std::vector<Territory *> grid;
+        for (int y = 0; y < width; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                auto *territory = new Territory("Territory " + std::to_string(grid.size()), x, y, continent, nullptr, 10);
+                continent->addTerritory(territory);
+                map.addTerritory(territory);
+                grid.push_back(territory);
+            }
+        }
+        for (int y = 0; y < width; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                Territory *territory = grid[y * width + x];
+                for (auto [dx, dy] : {std::pair{-1, 0}, {1, 0}, {0, -1}, {0, 1}})
+                    if (x + dx >= 0 && x + dx < width && y + dy >= 0 && y + dy < width)
+                        territory->addAdjacentTerritory(grid[(y + dy) * width + x + dx]);
+                Player *owner = x < width / 2 ? player : enemy;
+                territory->setOwner(owner);
+                owner->addTerritory(*territory);
+            }
+        }
+
+        //  Orders between random pairs of neighbouring territories, and random territories
+        const int numOrders = 1000000;
+        std::vector<CompactOrder> orders;
+        orders.reserve(numOrders);
+        for (int i = 0; i < numOrders; i++)
+        {
+            Territory *source = grid[random.nextIndex(grid.size())];
+            auto adjacent = source->getAdjacentTerritories();
+            Territory *target = adjacent[random.nextIndex(adjacent.size())];
+            switch (i % 4)
+            {
+            case 0:
+                orders.push_back(DeployAction{target, 1});
+                break;
+            case 1:
+                orders.push_back(AdvanceAction{target, source, 1});
+                break;
+            case 2:
+                orders.push_back(BombAction{target});
+                break;
+            default:
+                orders.push_back(AirliftAction{grid[random.nextIndex(grid.size())], source, 1});
+                break;
+            }
+        }
+
+        size_t valid = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const CompactOrder &order : orders)
+            valid += std::visit([player](const auto &action) -> bool
+            {
+                if constexpr (std::is_same_v<std::decay_t<decltype(action)>, Order *>)
+                    return false;
+                else
+                    return action.validate(player);
+            }, order);
+        double indexedTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        std::span<Territory *const> owned = player->getTerritories();
+        auto scanOwns = [&owned](Territory *territory) -> bool
+        { return std::find(owned.begin(), owned.end(), territory) != owned.end(); };
+        auto scanAdjacent = [&owned](Territory *territory) -> bool
+        { return std::any_of(owned.begin(), owned.end(), [territory](Territory *ownedTerritory)
+                             { return ownedTerritory->isTerritoryAdjacent(territory); }); };
+
+        size_t scanValid = 0;
+        start = std::chrono::steady_clock::now();
+        for (const CompactOrder &order : orders)
+        {
+            if (auto *deploy = std::get_if<DeployAction>(&order))
+                scanValid += scanOwns(deploy->target);
+            else if (auto *advance = std::get_if<AdvanceAction>(&order))
+                scanValid += scanOwns(advance->source) && advance->source->isTerritoryAdjacent(advance->target);
+            else if (auto *bomb = std::get_if<BombAction>(&order))
+                scanValid += !scanOwns(bomb->target) && scanAdjacent(bomb->target);
+            else if (auto *airlift = std::get_if<AirliftAction>(&order))
+                scanValid += scanOwns(airlift->source) && scanOwns(airlift->target);
+        }
+        double scanTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << grid.size() << " territories, " << owned.size() << " owned (" << valid << " valid orders"
+                  << (valid == scanValid ? "" : ", MISMATCH") << "):" << std::endl;
+        std::cout << "  Validate, indexed ownership: " << indexedTime / numOrders << " ns per order" << std::endl;
+        std::cout << "  Validate, scanning:          " << scanTime / numOrders << " ns per order" << std::endl;
+
+        delete player;
+        delete enemy;
+    }
+}
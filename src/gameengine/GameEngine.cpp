@@ -18,11 +18,15 @@
 #include <numeric>
 #include <memory>
 #include <algorithm>
+#include <tuple>
 
 #include "../../headers/gameengine/GameEngine.h"
 #include "../../headers/commandprocessing/ConsoleCommandProcessorAdapter.h"
 #include "../../headers/Map.h"
 #include "../../headers/player/Player.h"
+#include "../../headers/Cards.h"
+#include "../../headers/gameengine/GameOutput.h"
+#include "../../headers/AllocationCounter.h"
 
 #define PRESS_ENTER_TO_CONTINUE(clearConsole)   \
     std::string _IGNORE_STRING;                 \
@@ -70,10 +74,48 @@ static std::string reduceStringVector(const std::vector<std::string> &tokens)
     return stringBuilder;
 }
 
+/** \brief Seats a player at the truces of a game. Players past the last seat cannot negotiate. */
+static void seatPlayer(Player &player, NegotiationMatrix &negotiations, size_t seat)
+{
+    if (seat < NegotiationMatrix::MAX_SEATS)
+        player.setNegotiations(&negotiations, seat);
+    else
+        player.setNegotiations(nullptr, 0);
+}
+
+/** \brief Event notified to the observers of the game engine at the start of every turn of the game loop. */
+class TurnStartedEvent : public ILoggable
+{
+public:
+    explicit TurnStartedEvent(int turn) : turn(turn) {}
+
+    string stringToLog() override
+    {
+        return "Turn " + std::to_string(turn) + " started";
+    }
+
+    LogEntry toLogEntry() override
+    {
+        LogEntry entry;
+        entry.kind = LogEventKind::TurnStarted;
+        entry.value = turn;
+        return entry;
+    }
+
+private:
+    int turn;
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 //  "GameEngine" implementations
 
+GameEngine::GameEngine()
+    : neutralPlayer(new Player("Neutral"))
+{
+}
+
 GameEngine::GameEngine(const vector<State *> &states, CommandProcessor *commandProcessor)
+    : GameEngine()
 {
     this->ownedStates = states;
     this->currentState = *states.begin(); //  The first state in the vector
@@ -88,9 +130,17 @@ GameEngine::~GameEngine()
     for (const auto &state : ownedStates)
         delete state;
 
+    //  Hands go back to the deck, which deletes every card of the game when destroyed
     for (const auto &player : players)
+    {
+        player->returnCards(deck);
         delete player;
+    }
 
+    for (const auto &player : defeatedPlayers)
+        delete player;
+
+    delete neutralPlayer;
     delete commandProcessor;
     delete map;
 }
@@ -149,11 +199,22 @@ void GameEngine::execute()
     //  Set the isRunning status variable to 'true'
     isRunning = true;
 
+    //  Headless engines discard gameplay output on this thread while running
+    QuietGameOutput quietOutput(headless);
+
     while (isRunning)
     {
+        //  Nobody is there to type further commands
+        if (headless && commandProcessor->isExhausted())
+        {
+            std::cerr << "ERROR: Headless run ran out of commands in state [" << currentState->getStateName() << "]"
+                      << std::endl;
+            break;
+        }
+
         //  Printing out prompt
-        std::cout << "CURRENT STATE:\t[" << currentState->getStateName() << "]" << std::endl;
-        std::cout << "Please enter a command:\n";
+        gameOut() << "CURRENT STATE:\t[" << currentState->getStateName() << "]" << std::endl;
+        gameOut() << "Please enter a command:\n";
 
         //  Taking input
         auto command = std::make_unique<Command>(commandProcessor->getCommand(*currentState));
@@ -161,7 +222,10 @@ void GameEngine::execute()
         //  If input is empty, refresh
         if (command->getRawCommand().empty())
         {
-            system("cls");
+            if (!headless)
+            {
+                system("cls");
+            }
             continue;
         }
 
@@ -186,7 +250,10 @@ void GameEngine::execute()
         }
 
         //  Press enter to continue.
-        PRESS_ENTER_TO_CONTINUE(true)
+        if (!headless)
+        {
+            PRESS_ENTER_TO_CONTINUE(true)
+        }
     }
 }
 
@@ -198,6 +265,22 @@ void GameEngine::stopRunning()
     this->isRunning = false;
 }
 
+void GameEngine::setHeadless(bool isHeadless)
+{
+    this->headless = isHeadless;
+}
+
+void GameEngine::setMaxTurns(int turns)
+{
+    this->maxTurns = turns;
+}
+
+void GameEngine::setSeed(std::uint64_t newSeed)
+{
+    this->seed = newSeed;
+    random.seed(newSeed);
+}
+
 /**
  * \brief Further processes a command, calling its respective transition function.
  *
@@ -216,10 +299,11 @@ void GameEngine::processCommand(bool (*transitionFunction)(const std::vector<std
 
     //  Transition into the next state
     currentState = nextState;
+    notify(this);
 
     //  Print that you have switched states
     std::string newCurrentStateName = currentState->getStateName();
-    std::cout << "\033[34m"
+    gameOut() << "\033[34m"
               << "SWITCHED STATES TO:\t[" << newCurrentStateName << "]\033[0m" << std::endl;
 }
 
@@ -229,9 +313,9 @@ bool GameEngine::isGameRunning() const
     return isRunning;
 }
 
-std::vector<Player *> GameEngine::getPlayers() const
+bool GameEngine::isHeadless() const
 {
-    return players;
+    return headless;
 }
 
 Map *GameEngine::getMap() const
@@ -239,6 +323,46 @@ Map *GameEngine::getMap() const
     return map;
 }
 
+Deck &GameEngine::getDeck()
+{
+    return deck;
+}
+
+Player *GameEngine::getNeutralPlayer() const
+{
+    return neutralPlayer;
+}
+
+NegotiationMatrix &GameEngine::getNegotiations()
+{
+    return negotiations;
+}
+
+std::uint64_t GameEngine::getSeed() const
+{
+    return seed;
+}
+
+Random &GameEngine::getRandom()
+{
+    return random;
+}
+
+int GameEngine::getTurnsPlayed() const
+{
+    return turnsPlayed;
+}
+
+GameEngine::OrdersPhaseAllocations GameEngine::getLastOrdersPhaseAllocations() const
+{
+    return lastOrdersPhase;
+}
+
+Player *GameEngine::getWinner() const
+{
+    return winner;
+}
+
 //  Setter/Mutator methods
 CommandProcessor *GameEngine::getCommandProcessor()
 {
@@ -252,6 +376,8 @@ void GameEngine::setCommandProcessor(const CommandProcessor &newCommandProcessor
 
 void GameEngine::setMap(Map *newMap)
 {
+    if (newMap != map)
+        delete map;
     this->map = newMap;
 }
 
@@ -259,6 +385,15 @@ std::vector<Player *> GameEngine::setPlayers(std::vector<Player *> newPlayers)
 {
     auto tempVector = std::move(players);  //  Store old list of players
     this->players = std::move(newPlayers); //  Set the new list of players
+    negotiations.clear();                  //  Seats are given again, in the new order
+    for (size_t i = 0; i < players.size(); i++)
+    {
+        players[i]->setDeck(&deck);
+        players[i]->setRandom(&random);
+        players[i]->setNeutralPlayer(neutralPlayer);
+        seatPlayer(*players[i], negotiations, i);
+        attachObserversTo(*players[i]->getOrdersList());
+    }
     return tempVector;                     //  Return old list through temp variable
 }
 
@@ -276,6 +411,11 @@ Player *GameEngine::getPlayerByName(const std::string &name) const
 
 void GameEngine::addPlayer(Player *playerPtr)
 {
+    playerPtr->setDeck(&deck);
+    playerPtr->setRandom(&random);
+    playerPtr->setNeutralPlayer(neutralPlayer);
+    seatPlayer(*playerPtr, negotiations, players.size() + defeatedPlayers.size());
+    attachObserversTo(*playerPtr->getOrdersList());
     players.push_back(playerPtr);
 }
 
@@ -286,12 +426,22 @@ size_t GameEngine::numberOfPlayers() const
 
 void GameEngine::mainGameLoop()
 {
-    while (true)
+    turnsPlayed = 0;
+    winner = nullptr;
+
+    while (maxTurns <= 0 || turnsPlayed < maxTurns)
     {
+        TurnStartedEvent turnStarted(turnsPlayed + 1);
+        notify(&turnStarted);
+
+        //  Truces last until the end of the turn they are made in
+        negotiations.clear();
+
         for (Player *player : players)
         {
             player->setIssuingOrders(true);
-            cout << *player;
+            if (!isGameOutputQuiet())
+                gameOut() << *player;
         }
         // 1. Reinforcement phase
         reinforcementPhase();
@@ -301,14 +451,24 @@ void GameEngine::mainGameLoop()
         executeOrdersPhase();
         // Remove eliminated players
         removeDefeatedPlayers();
+        turnsPlayed++;
 
         // Check end game conditions
         if (players.size() == 1)
         {
-            cout << "Player " << players[0]->getName() << " wins!" << endl;
-            break;
+            winner = players[0];
+            gameOut() << "Player " << winner->getName() << " wins!" << endl;
+            flushObservers();
+            return;
         }
+
+        // Every player can be eliminated at once, when the last territories are blockaded
+        if (players.empty())
+            break;
     }
+
+    gameOut() << "The game ended in a draw after " << turnsPlayed << " turns." << endl;
+    flushObservers();
 }
 
 void GameEngine::reinforcementPhase()
@@ -330,9 +490,7 @@ void GameEngine::reinforcementPhase()
 // Check if player owns all territories in continent
 bool GameEngine::playerOwnsContinent(Player *player, Continent *continent)
 {
-    std::vector<Territory *> territories = continent->getTerritories();
-    return std::ranges::all_of(territories.begin(), territories.end(), [player](Territory *territory) -> bool
-                               { return territory->getOwner() == player; });
+    return player->ownsContinent(*continent);
 }
 
 void GameEngine::issueOrdersPhase()
@@ -343,7 +501,7 @@ void GameEngine::issueOrdersPhase()
         issuingOrders = false;
         for (Player *player : players)
         {
-            cout << player->isIssuingOrders();
+            gameOut() << player->isIssuingOrders();
             if (player->isIssuingOrders())
             {
                 player->issueOrders(this);
@@ -362,51 +520,69 @@ void GameEngine::issueOrdersPhase()
 
 void GameEngine::executeOrdersPhase()
 {
+    size_t ordersBoxed = 0;
     for (Player *player : players)
+        ordersBoxed += player->getOrdersList()->getOrdersBoxed();
+#ifdef COUNT_ALLOCATIONS
+    size_t heapAllocations = AllocationCounter::allocations();
+#endif
+
+    //  Every deploy order is executed before any other order. Within each phase, players take turns executing their
+    //  next order, in the player order. Once its deploy orders come first, every orders list is sorted on
+    //  (phase, round), so the lists are merged through a heap of their heads, keyed on (phase, round, player)
+    auto later = [](const ScheduledOrder &a, const ScheduledOrder &b) -> bool
+    { return std::tie(a.phase, a.round, a.player) > std::tie(b.phase, b.round, b.player); };
+    auto phaseOf = [](Order::OrderType type) -> int
+    { return type == Order::OrderType::Deploy ? 0 : 1; };
+    auto schedule = [this, &later](ScheduledOrder order)
+    {
+        orderSchedule.push_back(order);
+        std::push_heap(orderSchedule.begin(), orderSchedule.end(), later);
+    };
+
+    orderSchedule.clear();
+    for (size_t i = 0; i < players.size(); i++)
     {
-        if (player->getOrdersList()->size() == 0)
+        OrdersList *ordersList = players[i]->getOrdersList();
+        players[i]->setIssuingOrders(false);
+        if (ordersList->size() != 0)
         {
-            player->setIssuingOrders(false);
-        }
-        else
-        {
-            player->setIssuingOrders(true);
+            ordersList->moveDeployOrdersFirst();
+            schedule({phaseOf(ordersList->nextOrderType()), 0, i});
         }
     }
-    bool issuingOrders = true;
-    do
+
+    while (!orderSchedule.empty())
     {
-        issuingOrders = false;
-        for (Player *player : players)
+        std::pop_heap(orderSchedule.begin(), orderSchedule.end(), later);
+        ScheduledOrder next = orderSchedule.back();
+        orderSchedule.pop_back();
+        OrdersList *ordersList = players[next.player]->getOrdersList();
+        ordersList->executeNextOrder();
+        if (ordersList->size() != 0)
         {
-            if (player->isIssuingOrders())
-            {
-                OrdersList *ordersList = player->getOrdersList();
-                auto *nextOrder = ordersList->getNextOrder();
-                nextOrder->execute();
-                delete nextOrder;
-                if (player->getOrdersList()->size() == 0)
-                {
-                    player->setIssuingOrders(false);
-                }
-            }
+            int phase = phaseOf(ordersList->nextOrderType());
+            schedule({phase, phase == next.phase ? next.round + 1 : 0, next.player});
         }
-        for (Player *player : players)
-        {
-            if (player->isIssuingOrders())
-            {
-                issuingOrders = true;
-                break;
-            }
-        }
-    } while (issuingOrders);
+    }
+
+    lastOrdersPhase = {};
+    for (Player *player : players)
+        lastOrdersPhase.ordersBoxed += player->getOrdersList()->getOrdersBoxed();
+    lastOrdersPhase.ordersBoxed -= ordersBoxed;
+#ifdef COUNT_ALLOCATIONS
+    lastOrdersPhase.heapAllocations = AllocationCounter::allocations() - heapAllocations;
+#endif
 }
 
 void GameEngine::removeDefeatedPlayers()
 {
-    players.erase(std::remove_if(players.begin(), players.end(), [](Player *player) -> bool
-                                 { return player->getTerritories().size() == 0; }),
-                  players.end());
+    auto defeated = std::stable_partition(players.begin(), players.end(), [](Player *player) -> bool
+                                          { return player->getTerritories().size() != 0; });
+    for (auto it = defeated; it != players.end(); ++it)
+        (*it)->returnCards(deck);
+    defeatedPlayers.insert(defeatedPlayers.end(), defeated, players.end());
+    players.erase(defeated, players.end());
 }
 
 string GameEngine::stringToLog()
@@ -414,6 +590,14 @@ string GameEngine::stringToLog()
     return "GameEngine updated state: " + currentState->getStateName();
 }
 
+LogEntry GameEngine::toLogEntry()
+{
+    LogEntry entry;
+    entry.kind = LogEventKind::StateChanged;
+    entry.text = currentState->getStateName();
+    return entry;
+}
+
 #ifdef __GNUC__
 #pragma clang diagnostic pop
 #endif
@@ -0,0 +1,28 @@
+#include <iostream>
+
+#include "../../headers/gameengine/GameOutput.h"
+
+//  Whether gameplay output is discarded on this thread
+static thread_local bool quietOutput = false;
+
+std::ostream &gameOut()
+{
+    //  A stream without a buffer is permanently in a failed state: insertions return immediately without formatting
+    static thread_local std::ostream nullStream(nullptr);
+    return quietOutput ? nullStream : std::cout;
+}
+
+bool isGameOutputQuiet()
+{
+    return quietOutput;
+}
+
+QuietGameOutput::QuietGameOutput(bool quiet) : previous(quietOutput)
+{
+    quietOutput = quietOutput || quiet;
+}
+
+QuietGameOutput::~QuietGameOutput()
+{
+    quietOutput = previous;
+}
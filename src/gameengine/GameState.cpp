@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iostream>
+
+#include "../../headers/gameengine/GameState.h"
+#include "../../headers/gameengine/GameEngine.h"
+#include "../../headers/player/Player.h"
+#include "../../headers/Map.h"
+#include "../../headers/Cards.h"
+
+//  Returns the position of a player in the list of players of a game, as a territory owner
+static int32_t ownerIndex(std::span<Player *const> players, const Player *neutralPlayer, const Player *owner)
+{
+    if (owner == nullptr)
+        return GameState::NO_OWNER;
+    if (owner == neutralPlayer)
+        return GameState::NEUTRAL;
+    auto it = std::ranges::find(players, owner);
+    return it != players.end() ? static_cast<int32_t>(it - players.begin()) : GameState::NO_OWNER;
+}
+
+//  Counts the cards of each type in the hand of a player
+static std::array<int32_t, GameState::NUM_CARD_TYPES> countCards(const Player &player)
+{
+    std::array<int32_t, GameState::NUM_CARD_TYPES> counts = {};
+    for (const Card *card : player.getCards())
+        counts[static_cast<size_t>(card->getCardType())]++;
+    return counts;
+}
+
+GameState::GameState(GameEngine &gameEngine)
+{
+    const std::vector<Territory *> &territories = gameEngine.getMap()->getTerritories();
+    std::span<Player *const> players = gameEngine.getPlayers();
+    numTerritories = territories.size();
+    numPlayers = players.size();
+    values.assign(negotiationsOffset() + numPlayers, 0);
+
+    for (size_t i = 0; i < numTerritories; i++)
+    {
+        setArmies(i, territories[i]->getNumberOfArmies());
+        setOwner(i, ownerIndex(players, gameEngine.getNeutralPlayer(), territories[i]->getOwner()));
+    }
+
+    for (size_t i = 0; i < numPlayers; i++)
+    {
+        setReinforcementPool(i, players[i]->getReinforcementPool());
+        std::array<int32_t, NUM_CARD_TYPES> counts = countCards(*players[i]);
+        std::copy(counts.begin(), counts.end(), values.begin() + cardOffset(i, type(0)));
+        for (size_t other = 0; other < numPlayers; other++)
+            if (players[i]->isPlayerInNegotiations(*players[other]))
+                values[negotiationsOffset() + i] |= int32_t{1} << other;
+    }
+}
+
+void GameState::forkFrom(const GameState &other)
+{
+    numTerritories = other.numTerritories;
+    numPlayers = other.numPlayers;
+    values.resize(other.values.size());
+    std::memcpy(values.data(), other.values.data(), values.size() * sizeof(int32_t));
+}
+
+bool GameState::applyTo(GameEngine &gameEngine) const
+{
+    const std::vector<Territory *> &territories = gameEngine.getMap()->getTerritories();
+    std::span<Player *const> players = gameEngine.getPlayers();
+    if (territories.size() != numTerritories || players.size() != numPlayers)
+    {
+        std::cerr << "ERROR: The game state is not of this game (" << numTerritories << " territories and "
+                  << numPlayers << " players expected)" << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < numTerritories; i++)
+    {
+        Territory *territory = territories[i];
+        territory->setNumberOfArmies(getArmies(i));
+
+        int32_t ownerId = getOwner(i);
+        Player *owner = ownerId >= 0 ? players[ownerId] : ownerId == NEUTRAL ? gameEngine.getNeutralPlayer() : nullptr;
+        if (territory->getOwner() == owner)
+            continue;
+        if (territory->getOwner() != nullptr)
+            territory->getOwner()->removeTerritory(*territory);
+        territory->setOwner(owner);
+        if (owner != nullptr)
+            owner->addTerritory(*territory);
+    }
+
+    bool applied = true;
+    Deck &deck = gameEngine.getDeck();
+    gameEngine.getNegotiations().clear();
+    for (size_t i = 0; i < numPlayers; i++)
+    {
+        Player *player = players[i];
+        player->setReinforcements(getReinforcementPool(i));
+
+        //  Returning the extra cards first, so that other players can take them
+        std::array<int32_t, NUM_CARD_TYPES> counts = countCards(*player);
+        for (size_t cardType = 0; cardType < NUM_CARD_TYPES; cardType++)
+            for (int32_t count = counts[cardType]; count > getCardCount(i, type(cardType)); count--)
+                deck.addCard(player->removeCard(type(cardType)));
+    }
+    for (size_t i = 0; i < numPlayers; i++)
+    {
+        Player *player = players[i];
+        std::array<int32_t, NUM_CARD_TYPES> counts = countCards(*player);
+        for (size_t cardType = 0; cardType < NUM_CARD_TYPES; cardType++)
+        {
+            for (int32_t count = counts[cardType]; count < getCardCount(i, type(cardType)); count++)
+            {
+                Card *card = deck.take(type(cardType));
+                if (card == nullptr)
+                {
+                    std::cerr << "ERROR: The deck is missing cards of the game state" << std::endl;
+                    applied = false;
+                    break;
+                }
+                player->addCard(*card);
+            }
+        }
+
+        for (size_t other = i + 1; other < numPlayers; other++)
+            if (inNegotiation(i, other))
+                player->negotiateWith(*players[other]);
+    }
+    return applied;
+}
+
+void GameState::setNegotiation(size_t player, size_t otherPlayer, bool negotiating)
+{
+    if (negotiating)
+    {
+        values[negotiationsOffset() + player] |= int32_t{1} << otherPlayer;
+        values[negotiationsOffset() + otherPlayer] |= int32_t{1} << player;
+    }
+    else
+    {
+        values[negotiationsOffset() + player] &= ~(int32_t{1} << otherPlayer);
+        values[negotiationsOffset() + otherPlayer] &= ~(int32_t{1} << player);
+    }
+}
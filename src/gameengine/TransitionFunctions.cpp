@@ -10,12 +10,20 @@
 #include "../../headers/Map.h"
 #include "../../headers/player/Player.h"
 #include "../../headers/Cards.h"
+#include "../../headers/ThreadPool.h"
+#include "../../headers/Random.h"
+#include "../../headers/gameengine/GameOutput.h"
 
 #include <iostream>
 #include <string>
-#include <random>
 #include <vector>
+#include <span>
 #include <chrono>
+#include <algorithm>
+#include <iomanip>
+#include <filesystem>
+#include <future>
+#include <memory>
 
 #define PRESS_ENTER_TO_CONTINUE(clearConsole)   \
     std::string _IGNORE_STRING;                 \
@@ -30,6 +38,30 @@
 //----------------------------------------------------------------------------------------------------------------------
 //  Static 'helper' functions
 
+//  Names of the computer player strategies, as given to 'addplayer' and 'tournament'
+static const std::string COMPUTER_PLAYER_STRATEGIES[] = {"aggressive", "benevolent", "neutral", "cheater", "mcts"};
+
+/**
+ * \brief   Creates the computer player strategy with the given name.
+ * \param strategyName  One of "aggressive", "benevolent", "neutral", "cheater" or "mcts".
+ * \param player        The player the strategy plays for.
+ * \return  The new strategy, or nullptr if the name is not one of a computer player strategy.
+ */
+static PlayerStrategy *createPlayerStrategy(const std::string &strategyName, Player *player)
+{
+    if (strategyName == "aggressive")
+        return new AggressivePlayerStrategy(player);
+    if (strategyName == "benevolent")
+        return new BenevolentPlayerStrategy(player);
+    if (strategyName == "neutral")
+        return new NeutralPlayerStrategy(player);
+    if (strategyName == "cheater")
+        return new CheaterPlayerStrategy(player);
+    if (strategyName == "mcts")
+        return new MctsPlayerStrategy(player);
+    return nullptr;
+}
+
 /**
  * \brief   'Fairly' distributes territories to players.
  * \param players       List of players to evenly distribute territories to
@@ -43,6 +75,7 @@ static void distributeTerritories(const std::vector<Player *> &players, const st
         if (playersVectorIndex >= players.size())
             playersVectorIndex = 0;
 
+        territory->setOwner(players[playersVectorIndex]);
         players[playersVectorIndex++]->addTerritory(*territory);
     }
 }
@@ -53,40 +86,284 @@ static void distributeTerritories(const std::vector<Player *> &players, const st
  * \remarks Does not print out ALL details about the player, just the relevant information initialized during game start
  * \param players   The list/vector of players
  */
-static void printPlayerInfo(const std::vector<Player *> &players)
+static void printPlayerInfo(std::span<Player *const> players)
 {
     for (size_t i = 0; i < players.size(); i++)
     {
         auto *currentPlayer = players[i];
 
         //  Print out player name + their position in the order of play
-        std::cout << "[" << (i + 1) << "].    " << currentPlayer->getName() << std::endl;
+        gameOut() << "[" << (i + 1) << "].    " << currentPlayer->getName() << std::endl;
 
         //  Print out owned territories
-        std::cout << "  Territories:" << std::endl;
-        std::cout << "  FORMAT: NAME(x, y); CONTINENT" << std::endl;
+        gameOut() << "  Territories:" << std::endl;
+        gameOut() << "  FORMAT: NAME(x, y); CONTINENT" << std::endl;
         for (const auto &territory : currentPlayer->getTerritories())
         {
-            std::cout << "      - " << territory->getName() << "(" << territory->getX() << ", " << territory->getY()
+            gameOut() << "      - " << territory->getName() << "(" << territory->getX() << ", " << territory->getY()
                       << "); " << territory->getContinent()->getName() << std::endl;
         }
 
         //  Print out drawn cards
-        std::cout << "  Cards:" << std::endl;
+        gameOut() << "  Cards:" << std::endl;
         for (const auto &card : currentPlayer->getCards())
         {
-            std::cout << "      - " << *card << std::endl;
+            gameOut() << "      - " << *card << std::endl;
         }
 
         //  Prints out units in the reinforcement pool
-        std::cout << "  Units: (in reinforcement pool)" << std::endl;
-        std::cout << "      - " << currentPlayer->getUnits() << std::endl;
+        gameOut() << "  Units: (in reinforcement pool)" << std::endl;
+        gameOut() << "      - " << currentPlayer->getUnits() << std::endl;
 
         //  Add extra space for good formatting
-        std::cout << std::endl;
+        gameOut() << std::endl;
     }
 }
 
+/**
+ * \brief   Sets up the players of a game whose map is loaded and players are added: deals the territories, shuffles the
+ *          order of play, fills the reinforcement pools and draws the initial cards. See <code>game_gameStart</code>.
+ * \param gameEngine    Game object to set up.
+ * \return  True if the game could be set up, false if there are more players than territories.
+ */
+static bool setUpGame(GameEngine &gameEngine)
+{
+    const std::vector<Territory *> &territories = gameEngine.getMap()->getTerritories();
+    //  Copied: shuffled below to make the order of play
+    std::vector<Player *> players(gameEngine.getPlayers().begin(), gameEngine.getPlayers().end());
+
+    //  If there are more players than there are territories -> territories cannot be properly distributed
+    if (players.size() > territories.size())
+    {
+        std::cerr << "ERROR:    There are not enough territories for the number of players!" << std::endl;
+        return false;
+    }
+
+    //  1.  'Fairly' distributes all the territories to the player, once they can own any territory of the map without
+    //  allocating
+    for (Player *player : players)
+        player->reserveTerritories(*gameEngine.getMap());
+    gameEngine.getNeutralPlayer()->reserveTerritories(*gameEngine.getMap());
+    distributeTerritories(players, territories);
+
+    //  2.  Determine randomly the order of play of the players in the game
+    //  Does so by scrambling the players vector. Order goes from start of the vector, to the end.
+    Random &random = gameEngine.getRandom();
+    std::shuffle(players.begin(), players.end(), random);
+    (void)gameEngine.setPlayers(players);
+
+    //  3.  Give 50 initial army units to the players, which are placed in their respective reinforcement pool
+    for (Player *player : players)
+        player->addToReinforcementPool(50);
+
+    //  4.  Let each player draw 2 initial cards from the deck using the deck's 'draw()' method
+    //  The deck may run out of cards with many players
+    Deck &deck = gameEngine.getDeck();
+    for (Player *player : players)
+    {
+        //  Draw two cards from the deck
+        for (int i = 0; i < 2; i++)
+        {
+            if (Card *card = deck.draw(random))
+                player->addCard(*card);
+        }
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Tournament
+
+/** \brief Settings of a tournament, as given to the 'tournament' command. */
+struct TournamentSettings
+{
+    std::vector<std::string> mapFiles;      //  -M: the maps played on
+    std::vector<std::string> strategies;    //  -P: the strategy of each player, one player per strategy
+    int gamesPerMap = 0;                    //  -G: the number of games played on each map
+    int maxTurns = 0;                       //  -D: the number of turns after which a game is a draw
+    unsigned numThreads = 0;                //  -T: the number of games played at once, 0 for one per hardware thread
+};
+
+/** \brief Outcome of a single tournament game. */
+struct TournamentGameResult
+{
+    std::string winner;     //  Strategy of the winner, empty for a draw
+    int turns = 0;          //  Number of turns played
+};
+
+/**
+ * \brief   Parses the arguments of the 'tournament' command:
+ *          -M <map files> -P <strategies> -G <games per map> -D <max turns> [-T <threads>]
+ * \param values    Arguments of the command.
+ * \param settings  Receives the parsed settings.
+ * \return  True if the arguments are complete and valid, false otherwise. Errors are printed.
+ */
+static bool parseTournamentSettings(const std::vector<std::string> &values, TournamentSettings &settings)
+{
+    auto parsePositive = [](const std::string &value, const char *option, int &result) -> bool
+    {
+        try
+        {
+            result = std::stoi(value);
+        }
+        catch (const std::exception &)
+        {
+            result = 0;
+        }
+        if (result <= 0)
+            std::cerr << "ERROR: " << option << " expects a positive number, got \"" << value << "\"" << std::endl;
+        return result > 0;
+    };
+
+    std::string option;
+    for (const std::string &value : values)
+    {
+        if (value.size() == 2 && value[0] == '-')
+        {
+            option = value;
+            continue;
+        }
+
+        if (option == "-M")
+            settings.mapFiles.push_back(value);
+        else if (option == "-P")
+            settings.strategies.push_back(value);
+        else if (option == "-G" && !parsePositive(value, "-G", settings.gamesPerMap))
+            return false;
+        else if (option == "-D" && !parsePositive(value, "-D", settings.maxTurns))
+            return false;
+        else if (option == "-T")
+        {
+            int numThreads;
+            if (!parsePositive(value, "-T", numThreads))
+                return false;
+            settings.numThreads = static_cast<unsigned>(numThreads);
+        }
+        else if (option != "-G" && option != "-D")
+        {
+            std::cerr << "ERROR: Unexpected tournament argument \"" << value << "\"" << std::endl;
+            return false;
+        }
+    }
+
+    if (settings.mapFiles.empty() || settings.gamesPerMap <= 0 || settings.maxTurns <= 0)
+    {
+        std::cerr << "ERROR: A tournament needs maps (-M), a number of games (-G) and a turn limit (-D)!" << std::endl;
+        return false;
+    }
+    if (settings.strategies.size() < 2 || settings.strategies.size() > GameEngine::MAX_PLAYERS)
+    {
+        std::cerr << "ERROR: A tournament needs between 2 and " << GameEngine::MAX_PLAYERS << " strategies (-P)!"
+                  << std::endl;
+        return false;
+    }
+    for (const std::string &strategy : settings.strategies)
+    {
+        if (std::ranges::find(COMPUTER_PLAYER_STRATEGIES, strategy) == std::end(COMPUTER_PLAYER_STRATEGIES))
+        {
+            std::cerr << "ERROR: \"" << strategy << "\" is not a computer player strategy!" << std::endl;
+            std::cerr << "       Valid strategies: aggressive, benevolent, neutral, cheater, mcts" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * \brief   Plays a single tournament game to completion on the calling thread, with its own game engine and its own
+ *          copy of the map. Gameplay output is discarded.
+ * \param map           The map to play on. Only read, so that games can share it.
+ * \param strategies    The strategy of each player.
+ * \param maxTurns      The number of turns after which the game is a draw.
+ * \param seed          The seed of the game's random number generator.
+ * \return  The outcome of the game.
+ */
+static TournamentGameResult playTournamentGame(const Map &map, const std::vector<std::string> &strategies, int maxTurns,
+                                               std::uint64_t seed)
+{
+    QuietGameOutput quietOutput;
+
+    GameEngine gameEngine;
+    gameEngine.setHeadless(true);
+    gameEngine.setMaxTurns(maxTurns);
+    gameEngine.setSeed(seed);
+    gameEngine.setMap(new Map(map));
+
+    //  Players are named after their strategy, so that results can be tallied per strategy
+    for (const std::string &strategy : strategies)
+    {
+        auto *player = new Player(strategy);
+        player->setPlayerStrategy(createPlayerStrategy(strategy, player));
+        gameEngine.addPlayer(player);
+    }
+
+    TournamentGameResult result;
+    if (!setUpGame(gameEngine))
+        return result;
+
+    gameEngine.mainGameLoop();
+    if (Player *winner = gameEngine.getWinner())
+        result.winner = winner->getName();
+    result.turns = gameEngine.getTurnsPlayed();
+    return result;
+}
+
+/**
+ * \brief   Prints the results of a tournament: the wins of every strategy and the draws on each map.
+ * \param settings      Settings of the tournament.
+ * \param mapNames      Names of the maps that were played.
+ * \param results       Results of the games, per map.
+ */
+static void printTournamentResults(const TournamentSettings &settings, const std::vector<std::string> &mapNames,
+                                   const std::vector<std::vector<TournamentGameResult>> &results)
+{
+    //  Strategies can be given more than once, they are tallied together
+    std::vector<std::string> columns;
+    for (const std::string &strategy : settings.strategies)
+    {
+        if (std::find(columns.begin(), columns.end(), strategy) == columns.end())
+            columns.push_back(strategy);
+    }
+
+    size_t mapColumnWidth = 5;
+    for (const std::string &mapName : mapNames)
+        mapColumnWidth = std::max(mapColumnWidth, mapName.size());
+
+    auto printRow = [&](const std::string &name, const std::vector<TournamentGameResult> &games)
+    {
+        std::cout << std::left << std::setw(static_cast<int>(mapColumnWidth)) << name << std::right;
+        long totalTurns = 0;
+        for (const std::string &strategy : columns)
+        {
+            auto wins = std::count_if(games.begin(), games.end(), [&strategy](const TournamentGameResult &game)
+                                      { return game.winner == strategy; });
+            std::cout << " | " << std::setw(static_cast<int>(std::max<size_t>(strategy.size(), 6))) << wins;
+        }
+        auto draws = std::count_if(games.begin(), games.end(), [](const TournamentGameResult &game)
+                                   { return game.winner.empty(); });
+        for (const TournamentGameResult &game : games)
+            totalTurns += game.turns;
+
+        std::cout << " | " << std::setw(6) << draws << " | " << std::setw(10) << std::fixed << std::setprecision(1)
+                  << (games.empty() ? 0.0 : static_cast<double>(totalTurns) / static_cast<double>(games.size()))
+                  << std::endl;
+    };
+
+    std::cout << std::left << std::setw(static_cast<int>(mapColumnWidth)) << "Map" << std::right;
+    for (const std::string &strategy : columns)
+        std::cout << " | " << std::setw(static_cast<int>(std::max<size_t>(strategy.size(), 6))) << strategy;
+    std::cout << " | " << std::setw(6) << "draw" << " | " << std::setw(10) << "avg. turns" << std::endl;
+
+    std::vector<TournamentGameResult> allGames;
+    for (size_t i = 0; i < mapNames.size(); i++)
+    {
+        printRow(mapNames[i], results[i]);
+        allGames.insert(allGames.end(), results[i].begin(), results[i].end());
+    }
+    if (mapNames.size() > 1)
+        printRow("Total", allGames);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 bool game_restart(const std::vector<std::string> &values, GameEngine &gameEngine)
@@ -100,17 +377,37 @@ bool game_restart(const std::vector<std::string> &values, GameEngine &gameEngine
  * \remarks 1.  The function attempts to load the map using MapLoader's 'loadMap(...)' method.
  *              A 'nullptr' indicates file loading unsuccessful.
  *          2.  Load the map into the passed GameEngine object.
+ *          3.  With the '-binary' option, the precompiled binary sidecar ('<filepath>.bin') is loaded instead when it
+ *              is at least as recent as the .map file. Otherwise the .map file is parsed and the sidecar is
+ *              (re)written for the next load.
  *
  * \param values        Passed arguments. Note that these arguments are validated to be a certain of a certain number
- *                      before calling method. EXPECT 1 ARGUMENT: (std::string) filepath.
+ *                      before calling method. EXPECT 1 ARGUMENT: (std::string) filepath, optionally followed by
+ *                      '-binary'.
  * \param gameEngine    Game object to change/obtain values.
  * \return  True if loading was successful, false otherwise.
  */
 bool game_loadMap(const std::vector<std::string> &values, GameEngine &gameEngine)
 {
+    const std::string &filePath = values.front();
+    const bool useBinary = values.size() > 1 && values[1] == "-binary";
+    const std::string binaryPath = MapLoader::binaryPathFor(filePath);
+    Map *loadedMap = nullptr;
+
+    //  Prefer the precompiled binary map when it is up-to-date with the .map file
+    if (useBinary && MapLoader::isBinaryUpToDate(filePath, binaryPath))
+        loadedMap = MapLoader::loadBinary(binaryPath);
+
     //  Attempt to load map
-    auto mapLoader = std::make_unique<MapLoader>(values.front());
-    auto *loadedMap = mapLoader->load();
+    if (loadedMap == nullptr)
+    {
+        auto mapLoader = std::make_unique<MapLoader>(filePath);
+        loadedMap = mapLoader->load();
+
+        //  Precompile the map so that the next '-binary' load skips parsing
+        if (loadedMap != nullptr && useBinary)
+            MapLoader::writeBinary(*loadedMap, binaryPath);
+    }
 
     //  A 'nullptr' implies that the loading was unsuccessful
     if (loadedMap == nullptr)
@@ -120,7 +417,7 @@ bool game_loadMap(const std::vector<std::string> &values, GameEngine &gameEngine
     }
 
     //  Extra newline character for presentation
-    std::cout << std::endl;
+    gameOut() << std::endl;
 
     //  Transfer ownership of loaded map object to the game engine
     gameEngine.setMap(loadedMap);
@@ -146,9 +443,10 @@ bool game_validateMap(const std::vector<std::string> &_ignored_, GameEngine &gam
     }
 
     //  Check if valid, print a corresponding error/success message
-    if (mapPtr->getIsValid())
+    //  Failing territories/continents are reported by 'validate()' itself
+    if (mapPtr->validate())
     {
-        std::cout << "SUCCESS: Map has been successfully validated!" << std::endl;
+        gameOut() << "SUCCESS: Map has been successfully validated!" << std::endl;
         return true;
     }
     else
@@ -181,26 +479,13 @@ bool game_addPlayer(const std::vector<std::string> &values, GameEngine &gameEngi
     auto *newPlayer = new Player(playerName);
     if (values.size() >= 2)
     {
-        if (values[1] == "aggressive")
-        {
-            newPlayer->setPlayerStrategy(new AggressivePlayerStrategy(newPlayer));
-        }
-        else if (values[1] == "benevolent")
-        {
-            newPlayer->setPlayerStrategy(new BenevolentPlayerStrategy(newPlayer));
-        }
-        else if (values[1] == "neutral")
-        {
-            newPlayer->setPlayerStrategy(new NeutralPlayerStrategy(newPlayer));
-        }
-        else if (values[1] == "cheater")
-        {
-            newPlayer->setPlayerStrategy(new CheaterPlayerStrategy(newPlayer));
-        }
+        //  Players without a (known) computer strategy stay human players
+        if (auto *strategy = createPlayerStrategy(values[1], newPlayer))
+            newPlayer->setPlayerStrategy(strategy);
     }
     gameEngine.addPlayer(newPlayer);
 
-    std::cout << "Successfully added player!" << std::endl;
+    gameOut() << "Successfully added player!" << std::endl;
     return true;
 }
 
@@ -213,13 +498,13 @@ bool game_addPlayer(const std::vector<std::string> &values, GameEngine &gameEngi
  */
 bool game_printPlayers(const std::vector<std::string> &_ignored_, GameEngine &gameEngine)
 {
-    std::vector<Player *> players = gameEngine.getPlayers();
+    std::span<Player *const> players = gameEngine.getPlayers();
     size_t playerCount = 1; //   Counter variable to numerate the players when printing
 
-    std::cout << "  CURRENT PLAYERS" << std::endl;
+    gameOut() << "  CURRENT PLAYERS" << std::endl;
     for (auto *player : players)
     {
-        std::cout << "  " << (playerCount++) << ". " << player->getName() << std::endl;
+        gameOut() << "  " << (playerCount++) << ". " << player->getName() << std::endl;
     }
 
     return true;
@@ -242,46 +527,24 @@ bool game_printPlayers(const std::vector<std::string> &_ignored_, GameEngine &ga
  */
 bool game_gameStart(const std::vector<std::string> &values, GameEngine &gameEngine)
 {
-
-    std::vector<Territory *> territories = gameEngine.getMap()->getTerritories();
-    std::vector<Player *> players = gameEngine.getPlayers();
-
-    //  If there are more players than there are territories -> territories cannot be properly distributed
-    if (players.size() > territories.size())
-    {
-        std::cerr << "ERROR:    There are not enough territories for the number of players!" << std::endl;
+    if (!setUpGame(gameEngine))
         return false;
-    }
 
-    //  1.  'Fairly' distributes all the territories to the player
-    distributeTerritories(players, territories);
+    //  Print current config. The seed lets the game be replayed with '-seed'
+    gameOut() << "Random seed: " << gameEngine.getSeed() << std::endl;
+    if (!isGameOutputQuiet())
+        printPlayerInfo(gameEngine.getPlayers());
 
-    //  2.  Determine randomly the order of play of the players in the game
-    //  Does so by scrambling the players vector. Order goes from start of the vector, to the end.
-    auto seed = std::chrono::system_clock::now().time_since_epoch().count();
-    std::default_random_engine engine(seed);
-    std::shuffle(players.begin(), players.end(), engine);
-    (void)gameEngine.setPlayers(players);
-
-    //  3.  Give 50 initial army units to the players, which are placed in their respective reinforcement pool
-    for (Player *player : players)
-        player->addToReinforcementPool(50);
-
-    //  4.  Let each player draw 2 initial cards from the deck using the deck's 'draw()' method
-    Deck &deck = Deck::getInstance();
-    for (Player *player : players)
+    if (!gameEngine.isHeadless())
     {
-        //  Draw two cards from the deck
-        player->addCard(*deck.draw());
-        player->addCard(*deck.draw());
+        PRESS_ENTER_TO_CONTINUE(true)
     }
 
-    //  Print current config.
-    printPlayerInfo(players);
-
-    PRESS_ENTER_TO_CONTINUE(true)
-
     gameEngine.mainGameLoop();
+
+    //  A headless run ends with its game
+    if (gameEngine.isHeadless())
+        gameEngine.stopRunning();
     return true;
 }
 
@@ -297,9 +560,107 @@ bool game_quit(const std::vector<std::string> &values, GameEngine &gameEngine)
     return true;
 }
 
-bool game_tournament(const std::vector<std::string> &, GameEngine &)
+/**
+ * \brief   Plays a tournament: a number of computer player games on each of a list of maps, and prints the wins of each
+ *          strategy per map.
+ * \remarks 1.  Every map is loaded and validated once. Invalid maps, and maps with fewer territories than there are
+ *              players, are left out.
+ *          2.  Every game is played on a worker thread, with its own game engine and its own copy of the map. Games
+ *              play silently, and end in a draw after the turn limit.
+ *          3.  Prints a table of the wins per strategy and of the draws on each map, and the game throughput.
+ * \param values        Passed arguments: -M <map files> -P <strategies> -G <games per map> -D <max turns>, optionally
+ *                      followed by -T <threads> (defaults to one per hardware thread).
+ * \param gameEngine    Game object to change/obtain values.
+ * \return  True if the tournament was played, false otherwise.
+ */
+bool game_tournament(const std::vector<std::string> &values, GameEngine &gameEngine)
 {
     DEBUG_PRINT("GAME_TOURNAMENT")
+
+    TournamentSettings settings;
+    if (!parseTournamentSettings(values, settings))
+    {
+        std::cerr << "USAGE: tournament -M <map files> -P <strategies> -G <games per map> -D <max turns> [-T <threads>]"
+                  << std::endl;
+        return false;
+    }
+
+    //  1.  Load and validate every map once, games only read them
+    std::vector<std::unique_ptr<Map>> maps;
+    std::vector<std::string> mapNames;
+    for (const std::string &mapFile : settings.mapFiles)
+    {
+        std::unique_ptr<Map> map(MapLoader(mapFile).load());
+        if (map == nullptr || !map->validate())
+        {
+            std::cerr << "ERROR: \"" << mapFile << "\" is not a valid map, it is left out of the tournament!" << std::endl;
+            continue;
+        }
+        if (map->getNumTerritories() < settings.strategies.size())
+        {
+            std::cerr << "ERROR: \"" << mapFile << "\" has fewer territories than there are players, it is left out of "
+                      << "the tournament!" << std::endl;
+            continue;
+        }
+        maps.push_back(std::move(map));
+        mapNames.push_back(std::filesystem::path(mapFile).filename().string());
+    }
+    if (maps.empty())
+    {
+        std::cerr << "ERROR: None of the tournament maps can be played!" << std::endl;
+        return false;
+    }
+
+    //  2.  Play every game on the worker pool
+    //  Game seeds are drawn up front from the tournament's seed, so that the results do not depend on which game runs
+    //  on which thread
+    Random &random = gameEngine.getRandom();
+    ThreadPool pool(settings.numThreads);
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<std::vector<std::future<TournamentGameResult>>> games(maps.size());
+    for (size_t i = 0; i < maps.size(); i++)
+    {
+        const Map &map = *maps[i];
+        for (int game = 0; game < settings.gamesPerMap; game++)
+        {
+            std::uint64_t seed = random();
+            games[i].push_back(pool.submit([&map, &settings, seed]()
+                                           { return playTournamentGame(map, settings.strategies, settings.maxTurns,
+                                                                       seed); }));
+        }
+    }
+
+    std::vector<std::vector<TournamentGameResult>> results(maps.size());
+    for (size_t i = 0; i < maps.size(); i++)
+    {
+        for (auto &game : games[i])
+            results[i].push_back(game.get());
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    //  3.  Print the results
+    size_t numGames = maps.size() * static_cast<size_t>(settings.gamesPerMap);
+    std::cout << std::endl << "Tournament mode:" << std::endl;
+    std::cout << "  M: ";
+    for (size_t i = 0; i < mapNames.size(); i++)
+        std::cout << (i == 0 ? "" : ", ") << mapNames[i];
+    std::cout << std::endl << "  P: ";
+    for (size_t i = 0; i < settings.strategies.size(); i++)
+        std::cout << (i == 0 ? "" : ", ") << settings.strategies[i];
+    std::cout << std::endl << "  G: " << settings.gamesPerMap << std::endl;
+    std::cout << "  D: " << settings.maxTurns << std::endl;
+    std::cout << "  Seed: " << gameEngine.getSeed() << std::endl << std::endl;
+
+    printTournamentResults(settings, mapNames, results);
+
+    std::cout << std::endl << "Played " << numGames << " games in " << std::fixed << std::setprecision(3) << elapsed
+              << " s (" << std::setprecision(1) << (elapsed > 0 ? static_cast<double>(numGames) / elapsed : 0.0)
+              << " games/s) on " << pool.size() << " threads." << std::endl;
+
+    //  A headless run ends with its tournament
+    if (gameEngine.isHeadless())
+        gameEngine.stopRunning();
     return true;
 }
 
@@ -0,0 +1,441 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "../../headers/player/PlayerStrategies.h"
+#include "../../headers/player/Player.h"
+#include "../../headers/gameengine/GameEngine.h"
+#include "../../headers/gameengine/GameState.h"
+#include "../../headers/gameengine/GameOutput.h"
+#include "../../headers/Orders.h"
+#include "../../headers/Cards.h"
+#include "../../headers/Map.h"
+#include "../../headers/Combat.h"
+#include "../../headers/Random.h"
+#include "../../headers/ThreadPool.h"
+
+//  Turns a playout simulates, the planned turn included
+static constexpr int ROLLOUT_TURNS = 8;
+
+//  Exploration constant of UCB1
+static constexpr double EXPLORATION = 1.4;
+
+//  Playouts between two readings of the clock
+static constexpr size_t ROLLOUTS_PER_CLOCK_CHECK = 8;
+
+namespace
+{
+    //  Territory without continent
+    constexpr uint32_t NO_CONTINENT = UINT32_MAX;
+
+    //  What playouts need to know of a map, by territory and continent id
+    struct SimulationMap
+    {
+        std::vector<uint32_t> adjacencyOffsets;
+        std::vector<uint32_t> adjacency;
+        std::vector<uint32_t> continentOf;
+        std::vector<int32_t> continentBonus;
+        std::vector<int32_t> continentSize;
+
+        explicit SimulationMap(const Map &map)
+        {
+            const std::vector<Territory *> &territories = map.getTerritories();
+            adjacencyOffsets.reserve(territories.size() + 1);
+            adjacencyOffsets.push_back(0);
+            for (const Territory *territory : territories)
+            {
+                for (const Territory *adjacent : territory->getAdjacentTerritories())
+                    adjacency.push_back(static_cast<uint32_t>(adjacent->getId()));
+                adjacencyOffsets.push_back(static_cast<uint32_t>(adjacency.size()));
+                const Continent *continent = territory->getContinent();
+                continentOf.push_back(continent != nullptr ? static_cast<uint32_t>(continent->getId()) : NO_CONTINENT);
+            }
+            for (const Continent *continent : map.getContinents())
+            {
+                continentBonus.push_back(continent->getBonus());
+                continentSize.push_back(static_cast<int32_t>(continent->getTerritories().size()));
+            }
+        }
+
+        std::span<const uint32_t> neighbours(size_t territory) const
+        {
+            return {adjacency.data() + adjacencyOffsets[territory], adjacency.data() + adjacencyOffsets[territory + 1]};
+        }
+    };
+
+    //  Orders of a turn: the whole reinforcement pool deployed on a territory, then possibly a neighbour of it bombed
+    //  and attacked with all but one unit of the territory
+    struct Plan
+    {
+        uint32_t deployTarget = 0;
+        int32_t attackTarget = -1;
+        bool bomb = false;
+    };
+
+    //  Playouts and total score of a plan
+    struct PlanStatistics
+    {
+        size_t visits = 0;
+        double score = 0;
+    };
+
+    //  Returns whether a player can attack a territory with the given owner: another player they are not in
+    //  negotiation with, or the neutral player
+    bool attackable(const GameState &state, size_t player, int32_t owner)
+    {
+        if (owner == GameState::NEUTRAL)
+            return true;
+        return owner >= 0 && owner != static_cast<int32_t>(player) &&
+               !state.inNegotiation(player, static_cast<size_t>(owner));
+    }
+
+    //  Plays games on from a position, on a state of its own: one per searching thread
+    class Simulation
+    {
+    public:
+        Simulation(const SimulationMap &map, const GameState &root, size_t player, uint64_t seed)
+            : map(map), root(root), player(player), random(seed)
+        {
+        }
+
+        //  Plays the plan for the turn, then every player with the default policy, and scores the end position
+        double rollout(const Plan &plan)
+        {
+            state.forkFrom(root);
+            countTerritories();
+            playTurn(&plan, false);
+            for (int turn = 1; turn < ROLLOUT_TURNS && alivePlayers > 1 && owned[player] > 0; turn++)
+                playTurn(nullptr, true);
+            if (owned[player] == 0)
+                return 0;
+            if (alivePlayers == 1)
+                return 1;
+            return static_cast<double>(owned[player]) / static_cast<double>(state.getNumTerritories());
+        }
+
+    private:
+        const SimulationMap &map;
+        const GameState &root;
+        size_t player;
+        Random random;
+        GameState state;
+
+        //  Scratch space, reused from one playout to the next
+        std::vector<int32_t> owned;
+        std::vector<int32_t> ownedInContinent;
+        std::vector<uint32_t> candidates;
+        std::vector<Plan> plans;
+        std::vector<bool> playing;
+        size_t alivePlayers = 0;
+
+        //  Counts the territories of every player, in total and by continent
+        void countTerritories()
+        {
+            size_t numPlayers = state.getNumPlayers();
+            size_t numContinents = map.continentSize.size();
+            owned.assign(numPlayers, 0);
+            ownedInContinent.assign(numPlayers * numContinents, 0);
+            for (size_t territory = 0; territory < state.getNumTerritories(); territory++)
+            {
+                int32_t owner = state.getOwner(territory);
+                if (owner < 0)
+                    continue;
+                owned[owner]++;
+                if (map.continentOf[territory] != NO_CONTINENT)
+                    ownedInContinent[owner * numContinents + map.continentOf[territory]]++;
+            }
+            alivePlayers = static_cast<size_t>(std::ranges::count_if(owned, [](int32_t count) { return count > 0; }));
+        }
+
+        //  Default policy: deploys on a random territory bordering an enemy and attacks a random enemy neighbour
+        Plan defaultPlan(size_t current)
+        {
+            candidates.clear();
+            for (size_t territory = 0; territory < state.getNumTerritories(); territory++)
+            {
+                if (state.getOwner(territory) != static_cast<int32_t>(current))
+                    continue;
+                for (uint32_t adjacent : map.neighbours(territory))
+                {
+                    if (attackable(state, current, state.getOwner(adjacent)))
+                    {
+                        candidates.push_back(static_cast<uint32_t>(territory));
+                        break;
+                    }
+                }
+            }
+            Plan plan;
+            if (candidates.empty())
+            {
+                for (size_t territory = 0; territory < state.getNumTerritories(); territory++)
+                    if (state.getOwner(territory) == static_cast<int32_t>(current))
+                        candidates.push_back(static_cast<uint32_t>(territory));
+                plan.deployTarget = candidates[random.nextIndex(candidates.size())];
+                return plan;
+            }
+            plan.deployTarget = candidates[random.nextIndex(candidates.size())];
+
+            candidates.clear();
+            for (uint32_t adjacent : map.neighbours(plan.deployTarget))
+                if (attackable(state, current, state.getOwner(adjacent)))
+                    candidates.push_back(adjacent);
+            plan.attackTarget = static_cast<int32_t>(candidates[random.nextIndex(candidates.size())]);
+            plan.bomb = state.getCardCount(current, type::bomb) > 0;
+            return plan;
+        }
+
+        //  Plays a turn: reinforcements, then the deploys of every player, then their bombs and attacks in turn.
+        //  The territories must be counted, and are counted again at the end of the turn
+        void playTurn(const Plan *plan, bool reinforce)
+        {
+            size_t numPlayers = state.getNumPlayers();
+            size_t numContinents = map.continentSize.size();
+
+            plans.resize(numPlayers);
+            playing.assign(numPlayers, false);
+            for (size_t current = 0; current < numPlayers; current++)
+            {
+                if (owned[current] == 0)
+                    continue;
+                if (reinforce)
+                {
+                    int32_t reinforcements = std::max(owned[current] / 3, 3);
+                    for (size_t continent = 0; continent < numContinents; continent++)
+                        if (ownedInContinent[current * numContinents + continent] == map.continentSize[continent])
+                            reinforcements += map.continentBonus[continent];
+                    state.setReinforcementPool(current, state.getReinforcementPool(current) + reinforcements);
+                }
+                plans[current] = current == player && plan != nullptr ? *plan : defaultPlan(current);
+                playing[current] = true;
+            }
+
+            for (size_t current = 0; current < numPlayers; current++)
+            {
+                if (!playing[current])
+                    continue;
+                uint32_t deployTarget = plans[current].deployTarget;
+                state.setArmies(deployTarget, state.getArmies(deployTarget) + state.getReinforcementPool(current));
+                state.setReinforcementPool(current, 0);
+            }
+
+            for (size_t current = 0; current < numPlayers; current++)
+            {
+                if (!playing[current] || plans[current].attackTarget < 0)
+                    continue;
+                const Plan &currentPlan = plans[current];
+                auto target = static_cast<size_t>(currentPlan.attackTarget);
+                //  Territories lost earlier in the turn, and targets conquered or protected since, are skipped
+                if (state.getOwner(currentPlan.deployTarget) != static_cast<int32_t>(current) ||
+                    !attackable(state, current, state.getOwner(target)))
+                    continue;
+                if (currentPlan.bomb && state.getCardCount(current, type::bomb) > 0)
+                {
+                    state.setArmies(target, state.getArmies(target) / 2);
+                    state.setCardCount(current, type::bomb, state.getCardCount(current, type::bomb) - 1);
+                }
+                attack(current, currentPlan.deployTarget, target);
+            }
+            countTerritories();
+        }
+
+        //  Attacks a territory with all but one unit of another, as an advance order does
+        void attack(size_t current, size_t source, size_t target)
+        {
+            int32_t armyUnits = state.getArmies(source) - 1;
+            if (armyUnits <= 0)
+                return;
+            int32_t defenders = state.getArmies(target);
+            int32_t defenderUnitsKilled = sampleKills(armyUnits, ATTACKER_KILL_PROBABILITY, random);
+            int32_t attackerUnitsKilled = sampleKills(defenders, DEFENDER_KILL_PROBABILITY, random);
+            if (defenderUnitsKilled >= defenders)
+            {
+                state.setOwner(target, static_cast<int32_t>(current));
+                state.setArmies(source, state.getArmies(source) - armyUnits);
+                state.setArmies(target, std::max(armyUnits - attackerUnitsKilled, 0));
+                return;
+            }
+            state.setArmies(target, defenders - defenderUnitsKilled);
+            state.setArmies(source, state.getArmies(source) - std::min(attackerUnitsKilled, armyUnits));
+        }
+    };
+
+    //  Searches on one thread for the given number of playouts (0 for no limit), and until the deadline if there is one
+    std::vector<PlanStatistics> search(const SimulationMap &map, const GameState &root, size_t player,
+                                       const std::vector<Plan> &plans, uint64_t seed,
+                                       std::optional<std::chrono::steady_clock::time_point> deadline,
+                                       size_t maxRollouts)
+    {
+        Simulation simulation(map, root, player, seed);
+        std::vector<PlanStatistics> statistics(plans.size());
+        for (size_t rollouts = 0; maxRollouts == 0 || rollouts < maxRollouts; rollouts++)
+        {
+            //  Checked before the first playout too: a search started late has no time left
+            if (deadline && rollouts % ROLLOUTS_PER_CLOCK_CHECK == 0 && std::chrono::steady_clock::now() >= *deadline)
+                break;
+
+            //  Every plan is played once, then UCB1 balances the best plans against the least played
+            size_t chosen = rollouts;
+            if (rollouts >= plans.size())
+            {
+                double logRollouts = std::log(static_cast<double>(rollouts));
+                double bestBound = -1;
+                for (size_t i = 0; i < plans.size(); i++)
+                {
+                    auto visits = static_cast<double>(statistics[i].visits);
+                    double bound = statistics[i].score / visits + EXPLORATION * std::sqrt(logRollouts / visits);
+                    if (bound > bestBound)
+                    {
+                        bestBound = bound;
+                        chosen = i;
+                    }
+                }
+            }
+            statistics[chosen].score += simulation.rollout(plans[chosen]);
+            statistics[chosen].visits++;
+        }
+        return statistics;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  MCTS PLAYER STRATEGY
+MctsPlayerStrategy::MctsPlayerStrategy(Player *owner, size_t maxRollouts, unsigned numThreads,
+                                       std::chrono::milliseconds timeBudget)
+    : PlayerStrategy(owner), maxRollouts(maxRollouts), numThreads(numThreads), timeBudget(timeBudget)
+{
+    if (maxRollouts == 0 && timeBudget <= std::chrono::milliseconds::zero())
+    {
+        std::cerr << "ERROR: A search needs a number of playouts or a time budget, searching "
+                  << DEFAULT_ROLLOUTS << " playouts" << std::endl;
+        this->maxRollouts = DEFAULT_ROLLOUTS;
+    }
+}
+
+MctsPlayerStrategy::~MctsPlayerStrategy()
+{
+}
+
+void MctsPlayerStrategy::play()
+{
+}
+
+void MctsPlayerStrategy::issueOrders(GameEngine *gameEngine)
+{
+    if (!isGameOutputQuiet())
+        gameOut() << "In MCTS " << *player << std::endl;
+
+    //  A player conquered earlier this phase has nothing to issue orders from
+    std::span<Player *const> players = gameEngine->getPlayers();
+    auto position = std::ranges::find(players, player);
+    if (player->getTerritories().empty() || position == players.end())
+    {
+        player->setIssuingOrders(false);
+        return;
+    }
+    auto self = static_cast<size_t>(position - players.begin());
+
+    auto start = std::chrono::steady_clock::now();
+    const Map &map = *gameEngine->getMap();
+    SimulationMap simulationMap(map);
+    GameState root(*gameEngine);
+
+    //  The children of the root: deploying on each territory, and from the territories bordering an enemy, holding or
+    //  attacking each enemy neighbour, with or without a bomb
+    bool hasBomb = root.getCardCount(self, type::bomb) > 0;
+    std::vector<Plan> plans;
+    for (const Territory *territory : player->getTerritories())
+    {
+        auto deployTarget = static_cast<uint32_t>(territory->getId());
+        bool frontier = false;
+        for (uint32_t adjacent : simulationMap.neighbours(deployTarget))
+        {
+            if (!attackable(root, self, root.getOwner(adjacent)))
+                continue;
+            frontier = true;
+            plans.push_back({deployTarget, static_cast<int32_t>(adjacent), false});
+            if (hasBomb)
+                plans.push_back({deployTarget, static_cast<int32_t>(adjacent), true});
+        }
+        if (frontier)
+            plans.push_back({deployTarget, -1, false});
+    }
+    if (plans.empty())
+        for (const Territory *territory : player->getTerritories())
+            plans.push_back({static_cast<uint32_t>(territory->getId()), -1, false});
+
+    //  Every thread searches on its own, this one included, from a seed drawn from the game
+    unsigned numWorkers = numThreads != 0 ? numThreads : ThreadPool::hardwareThreads();
+    size_t workerRollouts = maxRollouts != 0 ? (maxRollouts + numWorkers - 1) / numWorkers : 0;
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+    if (timeBudget > std::chrono::milliseconds::zero())
+        deadline = start + timeBudget;
+    if (numWorkers > 1 && searchPool == nullptr)
+        searchPool = std::make_unique<ThreadPool>(numWorkers - 1);
+    std::vector<std::future<std::vector<PlanStatistics>>> workers;
+    for (unsigned i = 1; i < numWorkers; i++)
+    {
+        uint64_t seed = player->getRandom()();
+        workers.push_back(searchPool->submit([&, seed]() {
+            return search(simulationMap, root, self, plans, seed, deadline, workerRollouts);
+        }));
+    }
+    std::vector<PlanStatistics> statistics =
+        search(simulationMap, root, self, plans, player->getRandom()(), deadline, workerRollouts);
+    for (std::future<std::vector<PlanStatistics>> &worker : workers)
+    {
+        std::vector<PlanStatistics> workerStatistics = worker.get();
+        for (size_t i = 0; i < plans.size(); i++)
+        {
+            statistics[i].visits += workerStatistics[i].visits;
+            statistics[i].score += workerStatistics[i].score;
+        }
+    }
+
+    //  The most played plan is the most trusted one
+    size_t best = 0;
+    lastSearch = SearchStatistics{0, numWorkers, 0};
+    for (size_t i = 0; i < plans.size(); i++)
+    {
+        lastSearch.rollouts += statistics[i].visits;
+        if (statistics[i].visits > statistics[best].visits)
+            best = i;
+    }
+    lastSearch.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const std::vector<Territory *> &territories = map.getTerritories();
+    Territory *deployTarget = territories[plans[best].deployTarget];
+    int reinforcements = player->getReinforcementPool();
+    if (reinforcements > 0)
+        player->issueOrder(Order::OrderType::Deploy, deployTarget, reinforcements, nullptr, nullptr);
+    if (plans[best].attackTarget >= 0)
+    {
+        Territory *target = territories[plans[best].attackTarget];
+        if (plans[best].bomb)
+            player->issueOrder(Order::OrderType::Bomb, target, 0, nullptr, nullptr);
+        int armyUnits = deployTarget->getNumberOfArmies() + reinforcements - 1;
+        if (armyUnits > 0)
+            player->issueOrder(Order::OrderType::Advance, target, armyUnits, deployTarget, nullptr);
+    }
+    player->setIssuingOrders(false);
+}
+
+std::vector<Territory *> MctsPlayerStrategy::toAttack()
+{
+    return std::vector<Territory *>();
+}
+
+std::vector<Territory *> MctsPlayerStrategy::toDefend()
+{
+    return std::vector<Territory *>();
+}
+
+PlayerStrategy *MctsPlayerStrategy::clone(Player *owner) const
+{
+    return new MctsPlayerStrategy(owner, maxRollouts, numThreads, timeBudget);
+}
@@ -15,14 +15,15 @@
 #include "../../headers/player/Player.h"
 #include "../../headers/player/PlayerStrategies.h"
 #include "../../headers/gameengine/GameEngine.h"
+#include "../../headers/gameengine/NegotiationMatrix.h"
 #include "../../headers/Orders.h"
 #include "../../headers/Map.h"
 #include "../../headers/Cards.h"
+#include "../../headers/Random.h"
+#include "../../headers/gameengine/GameOutput.h"
 
 using namespace std;
 
-Player *Player::neutralPlayer = new Player("Neutral");
-
 //----------------------------------------------------------------------------------------------------------------------
 //  Constructors
 
@@ -56,19 +57,24 @@ Player::Player(const string &name, PlayerStrategy *playerStrategy, vector<Territ
     this->drawCard = false;      //  Start off with 'false' for now,
     this->playerStrategy = playerStrategy;
     this->ordersList = new OrdersList(this); //  Create an 'OrderList' object with this player as the owner
-    this->territories = std::move(territories);
+    for (Territory *territory : territories)
+        addTerritory(*territory);
     this->cards = std::move(cards);
-    this->playersInNegotiation = {};
 }
 
 //  Copy constructor
 Player::Player(const Player &otherPlayer)
-    : Player(otherPlayer.name, otherPlayer.playerStrategy->clone(), otherPlayer.territories, otherPlayer.cards)
+    : Player(otherPlayer.name, otherPlayer.playerStrategy->clone(this), otherPlayer.territories, otherPlayer.cards)
 {
     this->reinforcementPool = otherPlayer.reinforcementPool;
     this->drawCard = otherPlayer.drawCard;
-    this->ordersList = new OrdersList(*otherPlayer.ordersList); //  Copy the 'OrdersList'
-    this->playersInNegotiation = otherPlayer.playersInNegotiation;
+    delete this->ordersList; //  Replace the empty list of the delegated constructor by a copy, owned by this player
+    this->ordersList = new OrdersList(*otherPlayer.ordersList, this);
+    this->negotiations = otherPlayer.negotiations;
+    this->seat = otherPlayer.seat;
+    this->neutralPlayer = otherPlayer.neutralPlayer;
+    this->deck = otherPlayer.deck;
+    this->random = otherPlayer.random;
 }
 
 Player::~Player()
@@ -88,11 +94,24 @@ Player &Player::operator=(const Player &otherPlayer)
         name = otherPlayer.name;
         reinforcementPool = otherPlayer.reinforcementPool;
         drawCard = otherPlayer.drawCard;
-        playerStrategy = otherPlayer.playerStrategy->clone();
-        ordersList = new OrdersList(*otherPlayer.ordersList);
+        delete playerStrategy;
+        playerStrategy = otherPlayer.playerStrategy->clone(this);
+        delete ordersList;
+        ordersList = new OrdersList(*otherPlayer.ordersList, this);
         territories = otherPlayer.territories;
+        territoryIds = otherPlayer.territoryIds;
+        ownedTerritoryIds = otherPlayer.ownedTerritoryIds;
+        territoryPositions = otherPlayer.territoryPositions;
+        continentTerritories = otherPlayer.continentTerritories;
+        ownedNeighbours = otherPlayer.ownedNeighbours;
+        borderTerritories = otherPlayer.borderTerritories;
+        enemyNeighbours = otherPlayer.enemyNeighbours;
         cards = otherPlayer.cards;
-        playersInNegotiation = otherPlayer.playersInNegotiation;
+        negotiations = otherPlayer.negotiations;
+        seat = otherPlayer.seat;
+        neutralPlayer = otherPlayer.neutralPlayer;
+        deck = otherPlayer.deck;
+        random = otherPlayer.random;
     }
 
     return *this;
@@ -132,7 +151,7 @@ void Player::issueOrder(const string &type, Territory *target, int armyUnits, Te
     else if (type == "negotiate")
         issueOrder(Order::OrderType::Negotiate, target, armyUnits, source, player);
     else
-        cout << "Specified order is not allowed. No order was added to the orders list." << endl;
+        gameOut() << "Specified order is not allowed. No order was added to the orders list." << endl;
 }
 
 void Player::issueOrder(Order::OrderType orderType, Territory *target, int armyUnits, Territory *source, Player *player)
@@ -144,17 +163,17 @@ void Player::issueOrder(Order::OrderType orderType, Territory *target, int armyU
     case Order::OrderType::Deploy:
         if (armyUnits > 0 && armyUnits <= reinforcementPool)
         {
-            ordersList->addOrder(new DeployOrder(this, target, armyUnits));
+            ordersList->addOrder(DeployAction{target, armyUnits});
             reinforcementPool -= armyUnits;
             return;
         }
-        cout << "Specified number of army units is invalid. No order was added to the orders list." << endl;
+        gameOut() << "Specified number of army units is invalid. No order was added to the orders list." << endl;
         return;
 
     //  Issue an 'advance' order. No card has to be present like other orders.
     case Order::OrderType::Advance:
     {
-        ordersList->addOrder(new AdvanceOrder(this, target, armyUnits, source));
+        ordersList->addOrder(AdvanceAction{target, source, armyUnits});
         return;
     }
 
@@ -166,12 +185,13 @@ void Player::issueOrder(Order::OrderType orderType, Territory *target, int armyU
             if (cards[i]->getCardType() != type::bomb)
                 continue;
 
-            ordersList->addOrder(new BombOrder(this, target));
-            Deck::getInstance().addCard(cards[i]);
+            ordersList->addOrder(BombAction{target});
+            if (deck != nullptr)
+                deck->addCard(cards[i]);
             cards.erase(cards.begin() + i);
             return;
         }
-        cout << "The card to issue Bomb order was not found in the player's hand. No order was added to the orders list." << endl;
+        gameOut() << "The card to issue Bomb order was not found in the player's hand. No order was added to the orders list." << endl;
         return;
 
     //  We check if the player has a 'blockage' card. If so, we 'consume' the card and issue an order
@@ -183,12 +203,13 @@ void Player::issueOrder(Order::OrderType orderType, Territory *target, int armyU
             if (cards[i]->getCardType() != type::blockade)
                 continue;
 
-            ordersList->addOrder(new BlockadeOrder(this, target));
-            Deck::getInstance().addCard(cards[i]);
+            ordersList->addOrder(BlockadeAction{target});
+            if (deck != nullptr)
+                deck->addCard(cards[i]);
             cards.erase(cards.begin() + i);
             return;
         }
-        cout << "The card to issue Blockade order was not found in the player's hand. No order was added to the orders list." << endl;
+        gameOut() << "The card to issue Blockade order was not found in the player's hand. No order was added to the orders list." << endl;
         return;
     }
 
@@ -201,12 +222,13 @@ void Player::issueOrder(Order::OrderType orderType, Territory *target, int armyU
             if (cards[i]->getCardType() != type::airlift)
                 continue;
 
-            ordersList->addOrder(new AirliftOrder(this, target, armyUnits, source));
-            Deck::getInstance().addCard(cards[i]);
+            ordersList->addOrder(AirliftAction{target, source, armyUnits});
+            if (deck != nullptr)
+                deck->addCard(cards[i]);
             cards.erase(cards.begin() + i);
             return;
         }
-        cout << "The card to issue Airlift order was not found in the player's hand. No order was added to the orders list." << endl;
+        gameOut() << "The card to issue Airlift order was not found in the player's hand. No order was added to the orders list." << endl;
         return;
     }
 
@@ -219,17 +241,18 @@ void Player::issueOrder(Order::OrderType orderType, Territory *target, int armyU
             if (cards[i]->getCardType() != type::diplomacy)
                 continue;
 
-            ordersList->addOrder(new NegotiateOrder(this, player));
-            Deck::getInstance().addCard(cards[i]);
+            ordersList->addOrder(NegotiateAction{player});
+            if (deck != nullptr)
+                deck->addCard(cards[i]);
             cards.erase(cards.begin() + i);
             return;
         }
-        cout << "The card to issue Negotiate order was not found in the player's hand. No order was added to the orders list." << endl;
+        gameOut() << "The card to issue Negotiate order was not found in the player's hand. No order was added to the orders list." << endl;
         return;
     }
 
     default:
-        cout << "Specified order is not allowed. No order was added to the orders list." << endl;
+        gameOut() << "Specified order is not allowed. No order was added to the orders list." << endl;
         return;
     }
 }
@@ -241,6 +264,9 @@ PlayerStrategy *Player::getPlayerStrategy() const
 
 void Player::setPlayerStrategy(PlayerStrategy *playerStrategy)
 {
+    //  The player has sole ownership of its strategy
+    if (playerStrategy != Player::playerStrategy)
+        delete Player::playerStrategy;
     Player::playerStrategy = playerStrategy;
 }
 
@@ -268,11 +294,6 @@ int Player::getUnits() const { return reinforcementPool; }
 
 bool Player::drawsCard() const { return drawCard; }
 
-vector<Territory *> Player::getTerritories()
-{
-    return territories;
-}
-
 vector<const Card *> Player::getCards() const
 {
     vector<const Card *> cardsCopy(cards.size());
@@ -285,18 +306,6 @@ vector<const Card *> Player::getCards() const
     return cardsCopy;
 }
 
-vector<const Player *> Player::getPlayersInNegotiation() const
-{
-    vector<const Player *> playersInNegotiationCopy(playersInNegotiation.size());
-    std::transform(playersInNegotiation.begin(),
-                   playersInNegotiation.end(),
-                   playersInNegotiationCopy.begin(),
-                   [](Player *ptr) -> const Player *
-                   { return ptr; });
-
-    return playersInNegotiationCopy;
-}
-
 //----------------------------------------------------------------------------------------------------------------------
 //  Setter/Mutator methods
 
@@ -317,7 +326,55 @@ void Player::setDrawCard(bool doesDrawCard)
 
 void Player::addTerritory(Territory &newTerritory)
 {
+    if (ownsTerritory(newTerritory))
+        return;
+
+    size_t id = newTerritory.getId();
+    if (id >= ownedTerritoryIds.size())
+    {
+        size_t size = std::max(id + 1, 2 * ownedTerritoryIds.size());
+        ownedTerritoryIds.resize(size);
+        territoryPositions.resize(size);
+    }
+
+    ownedTerritoryIds.set(id);
+    territoryPositions[id] = territories.size();
     territories.push_back(&newTerritory);
+    territoryIds.push_back(id);
+
+    if (Continent *continent = newTerritory.getContinent())
+    {
+        if (continent->getId() >= continentTerritories.size())
+            continentTerritories.resize(continent->getId() + 1);
+        continentTerritories[continent->getId()]++;
+    }
+    updateFrontier(newTerritory, 1);
+}
+
+//  Position of a territory missing from a 'TerritorySet'
+static constexpr size_t NOT_LISTED = SIZE_MAX;
+
+void Player::reserveTerritories(const Map &map)
+{
+    size_t numTerritories = map.getNumTerritories();
+    territories.reserve(numTerritories);
+    territoryIds.reserve(numTerritories);
+    if (ownedTerritoryIds.size() < numTerritories)
+    {
+        ownedTerritoryIds.resize(numTerritories);
+        territoryPositions.resize(numTerritories);
+    }
+    if (continentTerritories.size() < map.getContinents().size())
+        continentTerritories.resize(map.getContinents().size());
+    if (ownedNeighbours.size() < numTerritories)
+        ownedNeighbours.resize(numTerritories);
+    for (TerritorySet *set : {&borderTerritories, &enemyNeighbours})
+    {
+        set->territories.reserve(numTerritories);
+        set->ids.reserve(numTerritories);
+        if (set->positions.size() < numTerritories)
+            set->positions.resize(numTerritories, NOT_LISTED);
+    }
 }
 
 void Player::addCard(Card &newCard)
@@ -325,44 +382,191 @@ void Player::addCard(Card &newCard)
     cards.push_back(&newCard);
 }
 
+Card *Player::removeCard(type cardType)
+{
+    auto it = std::ranges::find_if(cards, [cardType](const Card *card)
+                                   { return card->getCardType() == cardType; });
+    if (it == cards.end())
+        return nullptr;
+
+    Card *card = *it;
+    cards.erase(it);
+    return card;
+}
+
+void Player::returnCards(Deck &targetDeck)
+{
+    for (Card *card : cards)
+        targetDeck.addCard(card);
+    cards.clear();
+}
+
 void Player::negotiateWith(Player &player)
 {
-    if (!isPlayerInNegotiations(player))
-        playersInNegotiation.push_back(&player);
+    if (!canNegotiateWith(player))
+    {
+        std::cerr << "ERROR: " << name << " and " << player.name << " are not seated in the same game" << std::endl;
+        return;
+    }
+    negotiations->negotiate(seat, player.seat);
+}
+
+bool Player::canNegotiateWith(const Player &player) const
+{
+    return negotiations != nullptr && player.negotiations == negotiations && player.seat != seat;
 }
 
 void Player::removeTerritory(Territory &target)
 {
-    territories.erase(std::remove_if(territories.begin(), territories.end(), [&target](Territory *ptr)
-                                     { return &target == ptr; }),
-                      territories.end());
+    size_t id = target.getId();
+    if (!ownedTerritoryIds.test(id))
+        return;
+
+    size_t position = territoryPositions[id];
+    if (territories[position] != &target)
+        return;
+
+    removeTerritoryAt(position);
+    ownedTerritoryIds.reset(id);
+    if (Continent *continent = target.getContinent())
+        continentTerritories[continent->getId()]--;
+    updateFrontier(target, -1);
+}
+
+void Player::removeTerritoryAt(size_t position)
+{
+    size_t last = territories.size() - 1;
+    if (position != last)
+    {
+        territories[position] = territories[last];
+        territoryIds[position] = territoryIds[last];
+        territoryPositions[territoryIds[position]] = position;
+    }
+    territories.pop_back();
+    territoryIds.pop_back();
 }
 
 bool Player::ownsTerritory(Territory &territory) const
 {
-    auto it = std::find_if(territories.begin(), territories.end(),
-                           [&territory](Territory *ptr)
-                           {
-                               return &territory == ptr;
-                           });
+    size_t id = territory.getId();
+    if (!ownedTerritoryIds.test(id))
+        return false;
+
+    return territories[territoryPositions[id]] == &territory;
+}
 
-    return it != territories.end();
+size_t Player::territoriesOwnedIn(const Continent &continent) const
+{
+    return continent.getId() < continentTerritories.size() ? continentTerritories[continent.getId()] : 0;
+}
+
+bool Player::ownsContinent(const Continent &continent) const
+{
+    return territoriesOwnedIn(continent) == continent.getTerritories().size();
 }
 
 bool Player::isTerritoryAdjacent(Territory &target) const
 {
-    Territory *targetAsPtr = &target;
-    return std::ranges::any_of(territories, [targetAsPtr](Territory *ptr)
-                               { return ptr->isTerritoryAdjacent(targetAsPtr); });
+    return target.getId() < ownedNeighbours.size() && ownedNeighbours[target.getId()] > 0;
+}
+
+bool Player::isEnemyNeighbour(const Territory &territory) const
+{
+    size_t id = territory.getId();
+    return enemyNeighbours.contains(id) && enemyNeighbours.territories[enemyNeighbours.positions[id]] == &territory;
 }
 
-bool Player::isPlayerInNegotiations(Player &player) const
+void Player::updateFrontier(Territory &territory, int change)
 {
-    auto it = std::find_if(playersInNegotiation.begin(), playersInNegotiation.end(),
-                           [&player](Player *ptr)
-                           { return &player == ptr; });
+    for (Territory *adjacent : territory.getAdjacentTerritories())
+    {
+        size_t id = adjacent->getId();
+        if (id >= ownedNeighbours.size())
+            ownedNeighbours.resize(std::max(id + 1, 2 * ownedNeighbours.size()));
+        if (change > 0 || ownedNeighbours[id] > 0)
+            ownedNeighbours[id] += change;
+    }
+
+    classifyFrontier(territory);
+    for (Territory *adjacent : territory.getAdjacentTerritories())
+        classifyFrontier(*adjacent);
+}
 
-    return it != playersInNegotiation.end();
+void Player::classifyFrontier(Territory &territory)
+{
+    size_t id = territory.getId();
+    bool owned = ownsTerritory(territory);
+    uint32_t neighbours = id < ownedNeighbours.size() ? ownedNeighbours[id] : 0;
+
+    bool border = owned && neighbours < territory.getAdjacentTerritories().size();
+    if (border && !borderTerritories.contains(id))
+        borderTerritories.add(territory);
+    else if (!border && borderTerritories.contains(id))
+        borderTerritories.remove(id);
+
+    bool enemy = !owned && neighbours > 0;
+    if (enemy && !enemyNeighbours.contains(id))
+        enemyNeighbours.add(territory);
+    else if (!enemy && enemyNeighbours.contains(id))
+        enemyNeighbours.remove(id);
+}
+
+bool Player::TerritorySet::contains(size_t id) const
+{
+    return id < positions.size() && positions[id] != NOT_LISTED;
+}
+
+void Player::TerritorySet::add(Territory &territory)
+{
+    size_t id = territory.getId();
+    if (id >= positions.size())
+        positions.resize(std::max(id + 1, 2 * positions.size()), NOT_LISTED);
+    positions[id] = territories.size();
+    territories.push_back(&territory);
+    ids.push_back(id);
+}
+
+void Player::TerritorySet::remove(size_t id)
+{
+    size_t position = positions[id];
+    size_t last = territories.size() - 1;
+    territories[position] = territories[last];
+    ids[position] = ids[last];
+    positions[ids[position]] = position;
+    positions[id] = NOT_LISTED;
+    territories.pop_back();
+    ids.pop_back();
+}
+
+bool Player::isPlayerInNegotiations(const Player &player) const
+{
+    return canNegotiateWith(player) && negotiations->inNegotiation(seat, player.seat);
+}
+
+Deck *Player::getDeck() const
+{
+    return deck;
+}
+
+void Player::setDeck(Deck *newDeck)
+{
+    deck = newDeck;
+}
+
+Random &Player::getRandom() const
+{
+    return random != nullptr ? *random : Random::threadDefault();
+}
+
+void Player::setRandom(Random *newRandom)
+{
+    random = newRandom;
+}
+
+void Player::setNegotiations(NegotiationMatrix *newNegotiations, size_t newSeat)
+{
+    negotiations = newNegotiations;
+    seat = newSeat;
 }
 
 OrdersList *Player::getOrdersList() const
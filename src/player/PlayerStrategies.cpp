@@ -5,8 +5,12 @@
 #include "../../headers/Orders.h"
 #include "../../headers/Cards.h"
 #include "../../headers/Map.h"
+#include "../../headers/Random.h"
+#include "../../headers/Combat.h"
+#include "../../headers/gameengine/GameOutput.h"
 #include <sstream>
 #include <algorithm>
+#include <span>
 
 PlayerStrategy::PlayerStrategy(Player *player)
 {
@@ -15,6 +19,16 @@ PlayerStrategy::PlayerStrategy(Player *player)
 
 PlayerStrategy::~PlayerStrategy() = default;
 
+double PlayerStrategy::conquestProbability(int armyUnits, const Territory &target)
+{
+    return CombatOdds::conquestProbability(armyUnits, target.getNumberOfArmies());
+}
+
+double PlayerStrategy::expectedSurvivors(int armyUnits, const Territory &target)
+{
+    return CombatOdds::expectedSurvivors(armyUnits, target.getNumberOfArmies());
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // HUMAN PLAYER STRATEGY
 HumanPlayerStrategy::HumanPlayerStrategy(Player *owner) : PlayerStrategy(owner)
@@ -32,8 +46,8 @@ void HumanPlayerStrategy::play()
 void HumanPlayerStrategy::issueOrders(GameEngine *gameEngine)
 {
     //  Printing out prompt
-    std::cout << "CURRENT PLAYER:\t[" << player->getName() << "]" << std::endl;
-    std::cout << "Please issue an order \nOrder arguments in this order: <order name> <target territory> <# units> <source territory> <negotiate player>\nOnly enter the arguments that are needed for the specified order\n(enter 'finish' to finish issuing orders):\n";
+    gameOut() << "CURRENT PLAYER:\t[" << player->getName() << "]" << std::endl;
+    gameOut() << "Please issue an order \nOrder arguments in this order: <order name> <target territory> <# units> <source territory> <negotiate player>\nOnly enter the arguments that are needed for the specified order\n(enter 'finish' to finish issuing orders):\n";
 
     CommandProcessor *commandProcessor = gameEngine->getCommandProcessor();
     std::string command_str = commandProcessor->getCommand();
@@ -77,7 +91,7 @@ void HumanPlayerStrategy::issueOrders(GameEngine *gameEngine)
         return;
 
     default:
-        cout << "Specified order is not allowed. No order was added to the orders list." << endl;
+        gameOut() << "Specified order is not allowed. No order was added to the orders list." << endl;
         return;
     }
 }
@@ -92,9 +106,9 @@ std::vector<Territory *> HumanPlayerStrategy::toDefend()
     return std::vector<Territory *>();
 }
 
-PlayerStrategy *HumanPlayerStrategy::clone()
+PlayerStrategy *HumanPlayerStrategy::clone(Player *owner) const
 {
-    return nullptr;
+    return new HumanPlayerStrategy(owner);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -113,7 +127,16 @@ void AggressivePlayerStrategy::play()
 
 void AggressivePlayerStrategy::issueOrders(GameEngine *)
 {
-    cout << "In aggressive " << *player << endl;
+    if (!isGameOutputQuiet())
+        gameOut() << "In aggressive " << *player << endl;
+
+    // A player conquered earlier this phase has nothing to issue orders from
+    if (player->getTerritories().empty())
+    {
+        player->setIssuingOrders(false);
+        return;
+    }
+
     // Deploys all reinforcements to one of the strongest territories
     vector<Territory *> strongest = vector<Territory *>();
     for (Territory *territory : player->getTerritories())
@@ -132,8 +155,8 @@ void AggressivePlayerStrategy::issueOrders(GameEngine *)
             strongest.push_back(territory);
         }
     }
-    srand(time(NULL));
-    int strongest_index = rand() % strongest.size();
+    Random &random = player->getRandom();
+    size_t strongest_index = random.nextIndex(strongest.size());
     player->issueOrder(Order::OrderType::Deploy, strongest[strongest_index], player->getReinforcementPool(), nullptr, nullptr);
 
     // Bombs an opponent's territory
@@ -142,42 +165,46 @@ void AggressivePlayerStrategy::issueOrders(GameEngine *)
     {
         if (cards[i]->getCardType() != type::bomb)
             continue;
-        vector<Territory *> potential_bombing = vector<Territory *>();
-        for (Territory *territory : player->getTerritories())
-        {
-            for (Territory *adjacent : territory->getAdjacentTerritories())
-            {
-                potential_bombing.push_back(adjacent);
-            }
-        }
-        int bombing_index = rand() % potential_bombing.size();
+        std::span<Territory *const> potential_bombing = player->getEnemyNeighbours();
+        if (potential_bombing.empty())
+            break;
+        size_t bombing_index = random.nextIndex(potential_bombing.size());
         player->issueOrder(Order::OrderType::Bomb, potential_bombing[bombing_index], 0, nullptr, nullptr);
         break;
     }
 
-    // Attacks or moves from strongest territory
+    // Attacks the opponents' territories it is the most likely to conquer from the strongest territory, or moves
+    Territory *source = strongest[strongest_index];
+    std::span<Territory *const> sourceAdjacent = source->getAdjacentTerritories();
     vector<Territory *> opponent_adjacent = vector<Territory *>();
-    for (Territory *territory : strongest[strongest_index]->getAdjacentTerritories())
+    double bestOdds = -1.0;
+    for (Territory *territory : sourceAdjacent)
     {
-        if (territory->getOwner() != player)
+        if (territory->getOwner() == player)
+            continue;
+        double odds = conquestProbability(source->getNumberOfArmies() - 1, *territory);
+        if (odds > bestOdds)
         {
-            opponent_adjacent.push_back(territory);
+            bestOdds = odds;
+            opponent_adjacent.clear();
         }
+        if (odds == bestOdds)
+            opponent_adjacent.push_back(territory);
     }
     if (opponent_adjacent.size() > 0)
     {
-        int attack_index = rand() % opponent_adjacent.size();
-        if (strongest[strongest_index]->getNumberOfArmies() > 0)
+        size_t attack_index = random.nextIndex(opponent_adjacent.size());
+        if (source->getNumberOfArmies() > 0)
         {
-            player->issueOrder(Order::OrderType::Advance, opponent_adjacent[attack_index], strongest[strongest_index]->getNumberOfArmies() - 1, strongest[strongest_index], nullptr);
+            player->issueOrder(Order::OrderType::Advance, opponent_adjacent[attack_index], source->getNumberOfArmies() - 1, source, nullptr);
         }
     }
     else
     {
-        int move_index = rand() % strongest[strongest_index]->getAdjacentTerritories().size();
-        if (strongest[strongest_index]->getNumberOfArmies() > 0)
+        size_t move_index = random.nextIndex(sourceAdjacent.size());
+        if (source->getNumberOfArmies() > 0)
         {
-            player->issueOrder(Order::OrderType::Advance, strongest[strongest_index]->getAdjacentTerritories()[move_index], strongest[strongest_index]->getNumberOfArmies() - 1, strongest[strongest_index], nullptr);
+            player->issueOrder(Order::OrderType::Advance, sourceAdjacent[move_index], source->getNumberOfArmies() - 1, source, nullptr);
         }
     }
     player->setIssuingOrders(false);
@@ -193,9 +220,9 @@ std::vector<Territory *> AggressivePlayerStrategy::toDefend()
     return std::vector<Territory *>();
 }
 
-PlayerStrategy *AggressivePlayerStrategy::clone()
+PlayerStrategy *AggressivePlayerStrategy::clone(Player *owner) const
 {
-    return nullptr;
+    return new AggressivePlayerStrategy(owner);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -214,7 +241,15 @@ void BenevolentPlayerStrategy::play()
 
 void BenevolentPlayerStrategy::issueOrders(GameEngine *gameEngine)
 {
-    cout << "In benevolent player issueOrders\n";
+    gameOut() << "In benevolent player issueOrders\n";
+
+    // A player conquered earlier this phase has nothing to issue orders from
+    if (player->getTerritories().empty())
+    {
+        player->setIssuingOrders(false);
+        return;
+    }
+
     // Deploys all reinforcements to the weakest territories
     vector<Territory *> weakest = vector<Territory *>();
     for (Territory *territory : player->getTerritories())
@@ -246,12 +281,16 @@ void BenevolentPlayerStrategy::issueOrders(GameEngine *gameEngine)
     {
         if (cards[i]->getCardType() != type::diplomacy)
             continue;
-        int bombing_index = 0;
-        do
+        // Negotiates with a random opponent: the n-th player other than this one
+        std::span<Player *const> players = gameEngine->getPlayers();
+        size_t numOpponents = players.size() - std::ranges::count(players, player);
+        if (numOpponents != 0)
         {
-            bombing_index = gameEngine->getPlayers().size();
-        } while (gameEngine->getPlayers()[bombing_index] == player);
-        player->issueOrder(Order::OrderType::Negotiate, nullptr, 0, nullptr, gameEngine->getPlayers()[bombing_index]);
+            size_t opponentIndex = player->getRandom().nextIndex(numOpponents);
+            auto opponent = std::ranges::find_if(players, [this, &opponentIndex](Player *candidate)
+                                                 { return candidate != player && opponentIndex-- == 0; });
+            player->issueOrder(Order::OrderType::Negotiate, nullptr, 0, nullptr, *opponent);
+        }
         break;
     }
     player->setIssuingOrders(false);
@@ -267,9 +306,9 @@ std::vector<Territory *> BenevolentPlayerStrategy::toDefend()
     return std::vector<Territory *>();
 }
 
-PlayerStrategy *BenevolentPlayerStrategy::clone()
+PlayerStrategy *BenevolentPlayerStrategy::clone(Player *owner) const
 {
-    return nullptr;
+    return new BenevolentPlayerStrategy(owner);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -288,7 +327,7 @@ void NeutralPlayerStrategy::play()
 
 void NeutralPlayerStrategy::issueOrders(GameEngine *)
 {
-    cout << "In neutral player issueOrders\n";
+    gameOut() << "In neutral player issueOrders\n";
     player->setIssuingOrders(false);
 }
 
@@ -302,9 +341,9 @@ std::vector<Territory *> NeutralPlayerStrategy::toDefend()
     return std::vector<Territory *>();
 }
 
-PlayerStrategy *NeutralPlayerStrategy::clone()
+PlayerStrategy *NeutralPlayerStrategy::clone(Player *owner) const
 {
-    return nullptr;
+    return new NeutralPlayerStrategy(owner);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -323,15 +362,10 @@ void CheaterPlayerStrategy::play()
 
 void CheaterPlayerStrategy::issueOrders(GameEngine *)
 {
-    cout << "In cheater player issueOrders\n";
-    vector<Territory *> toConquer = vector<Territory *>();
-    for (Territory *territory : player->getTerritories())
-    {
-        for (Territory *adjacent : territory->getAdjacentTerritories())
-        {
-            toConquer.push_back(adjacent);
-        }
-    }
+    gameOut() << "In cheater player issueOrders\n";
+    // Copied, as the frontier changes with every conquest
+    std::span<Territory *const> enemyNeighbours = player->getEnemyNeighbours();
+    vector<Territory *> toConquer(enemyNeighbours.begin(), enemyNeighbours.end());
 
     for (Territory *territory : toConquer)
     {
@@ -352,7 +386,7 @@ std::vector<Territory *> CheaterPlayerStrategy::toDefend()
     return std::vector<Territory *>();
 }
 
-PlayerStrategy *CheaterPlayerStrategy::clone()
+PlayerStrategy *CheaterPlayerStrategy::clone(Player *owner) const
 {
-    return nullptr;
+    return new CheaterPlayerStrategy(owner);
 }
@@ -0,0 +1,188 @@
+/*
+ *  Offline decoder of the binary event log written by BinaryLogObserver: renders every record as a line of text.
+ *
+ *      COMP345_LOG_DECODER <gamelog.bin> [output file]
+ *
+ *  The text is written to the output file if one is given, to the standard output otherwise.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "../../headers/EventLogFormat.h"
+#include "../../headers/MappedFile.h"
+
+//  Names of Order::OrderType, by value
+static constexpr std::string_view ORDER_TYPE_NAMES[] = {"Deploy", "Advance", "Bomb", "Blockade", "Airlift", "Negotiate"};
+
+static std::string_view orderTypeName(std::uint8_t orderType)
+{
+    return orderType < std::size(ORDER_TYPE_NAMES) ? ORDER_TYPE_NAMES[orderType] : "Invalid";
+}
+
+//  Names bound to the player and territory ids of the current game
+struct NameTables
+{
+    std::unordered_map<std::uint32_t, std::string> players;
+    std::unordered_map<std::uint32_t, std::string> territories;
+
+    static std::string_view find(const std::unordered_map<std::uint32_t, std::string> &names, std::uint32_t id)
+    {
+        auto it = names.find(id);
+        return it != names.end() ? std::string_view(it->second) : std::string_view("?");
+    }
+
+    std::string_view player(std::uint32_t id) const { return find(players, id); }
+    std::string_view territory(std::uint32_t id) const { return find(territories, id); }
+};
+
+/**
+ * \brief   Writes the text of a record to the output. Name records only fill the name tables
+ */
+static void decodeRecord(const EventRecord &record, std::string_view text, NameTables &names, std::ostream &output)
+{
+    switch (record.kind)
+    {
+    case LogEventKind::PlayerName:
+        names.players[static_cast<std::uint32_t>(record.value)] = text;
+        return;
+
+    case LogEventKind::TerritoryName:
+        names.territories[static_cast<std::uint32_t>(record.value)] = text;
+        return;
+
+    case LogEventKind::TurnStarted:
+        output << "Turn " << record.value << " started\n";
+        return;
+
+    case LogEventKind::StateChanged:
+        output << "GameEngine updated state: " << text << '\n';
+        return;
+
+    case LogEventKind::OrderIssued:
+        output << "Turn " << record.turn << " | New Order added: " << orderTypeName(record.orderType)
+               << ", player = " << names.player(record.player) << '\n';
+        return;
+
+    case LogEventKind::OrderExecuted:
+        output << "Turn " << record.turn << " | Order executed: type = " << orderTypeName(record.orderType)
+               << ", player = " << names.player(record.player);
+        if (record.otherPlayer != EVENT_LOG_NO_ID)
+            output << ", other player = " << names.player(record.otherPlayer);
+        if (record.source != EVENT_LOG_NO_ID)
+            output << ", source = " << names.territory(record.source);
+        if (record.target != EVENT_LOG_NO_ID)
+            output << ", target = " << names.territory(record.target) << " (" << record.value << " armies)";
+        if (record.armies != 0)
+            output << ", army units = " << record.armies;
+        output << '\n';
+        return;
+
+    case LogEventKind::Text:
+        output << text << '\n';
+        return;
+
+    default:
+        output << "Unknown event " << static_cast<int>(record.kind) << '\n';
+        return;
+    }
+}
+
+/**
+ * \brief   Decodes a whole log. Returns false if the file is not a readable event log
+ */
+static bool decodeLog(const MappedFile &log, std::ostream &output)
+{
+    if (log.size() < sizeof(EventLogHeader))
+    {
+        std::cerr << "ERROR: The file is too small to be an event log." << std::endl;
+        return false;
+    }
+
+    EventLogHeader header{};
+    std::memcpy(&header, log.data(), sizeof(EventLogHeader));
+    if (std::memcmp(header.magic, EVENT_LOG_MAGIC, sizeof(EVENT_LOG_MAGIC)) != 0)
+    {
+        std::cerr << "ERROR: The file is not an event log." << std::endl;
+        return false;
+    }
+    if (header.byteOrder != EVENT_LOG_BYTE_ORDER)
+    {
+        std::cerr << "ERROR: The event log was written on a machine of another byte order." << std::endl;
+        return false;
+    }
+    if (header.version != EVENT_LOG_VERSION)
+    {
+        std::cerr << "ERROR: Unsupported event log version " << header.version << "." << std::endl;
+        return false;
+    }
+
+    //  A log that was not closed properly has no record count: it is read up to its first unused record
+    std::uint64_t availableBlocks = (log.size() - sizeof(EventLogHeader)) / sizeof(EventRecord);
+    std::uint64_t numBlocks = header.numRecords != 0 && header.numRecords <= availableBlocks ? header.numRecords
+                                                                                             : availableBlocks;
+    if (header.numRecords > availableBlocks)
+        std::cerr << "WARNING: The event log is truncated." << std::endl;
+
+    const char *blocks = log.data() + sizeof(EventLogHeader);
+    NameTables names;
+    std::uint64_t index = 0;
+    while (index < numBlocks)
+    {
+        EventRecord record{};
+        std::memcpy(&record, blocks + index * sizeof(EventRecord), sizeof(EventRecord));
+        if (record.kind == LogEventKind::None)
+            break;
+
+        std::uint64_t textBlocks = (record.textLength + sizeof(EventRecord) - 1) / sizeof(EventRecord);
+        if (index + 1 + textBlocks > numBlocks)
+        {
+            std::cerr << "WARNING: The last record of the event log is incomplete." << std::endl;
+            break;
+        }
+
+        //  Turn 1 starts a new game, whose ids are bound again
+        if (record.kind == LogEventKind::TurnStarted && record.value == 1)
+            names = NameTables();
+
+        std::string_view text(blocks + (index + 1) * sizeof(EventRecord), record.textLength);
+        decodeRecord(record, text, names, output);
+        index += 1 + textBlocks;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <gamelog.bin> [output file]" << std::endl;
+        return 1;
+    }
+
+    MappedFile log(argv[1]);
+    if (!log.isOpen())
+    {
+        std::cerr << "ERROR: Unable to open the event log \"" << argv[1] << "\"." << std::endl;
+        return 1;
+    }
+
+    if (argc == 3)
+    {
+        std::ofstream output(argv[2], std::ios::out | std::ios::trunc);
+        if (!output.is_open())
+        {
+            std::cerr << "ERROR: Unable to open the output file \"" << argv[2] << "\"." << std::endl;
+            return 1;
+        }
+        return decodeLog(log, output) ? 0 : 1;
+    }
+
+    std::ios::sync_with_stdio(false);
+    return decodeLog(log, std::cout) ? 0 : 1;
+}